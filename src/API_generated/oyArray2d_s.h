@@ -133,6 +133,12 @@ OYAPI oyArray2d_s * OYEXPORT
                                        int                 height,
                                        oyDATATYPE_e        type,
                                        oyObject_s          object );
+OYAPI oyArray2d_s * OYEXPORT
+                 oyArray2d_CreateAligned (
+                                       int                 width,
+                                       int                 height,
+                                       oyDATATYPE_e        data_type,
+                                       oyObject_s          object );
 OYAPI int OYEXPORT
                  oyArray2d_Reset     ( oyArray2d_s       * array,
                                        int                 width,
@@ -147,6 +153,12 @@ OYAPI int  OYEXPORT
                  oyArray2d_SetRows   ( oyArray2d_s       * obj,
                                        oyPointer         * rows,
                                        int                 do_copy );
+OYAPI int  OYEXPORT
+                 oyArray2d_SetDataStride (
+                                       oyArray2d_s       * obj,
+                                       oyPointer           data,
+                                       int                 stride,
+                                       int                 own_data );
 OYAPI int  OYEXPORT  oyArray2d_SetFocus (
                                        oyArray2d_s       * array,
                                        oyRectangle_s     * rectangle );
@@ -157,6 +169,11 @@ OYAPI int  OYEXPORT
                  oyArray2d_GetWidth  ( oyArray2d_s       * obj );
 OYAPI int  OYEXPORT
                  oyArray2d_GetHeight ( oyArray2d_s       * obj );
+OYAPI int  OYEXPORT
+                 oyArray2d_GetStride ( oyArray2d_s       * array );
+OYAPI size_t  OYEXPORT
+                 oyArray2d_SetPoolBudget (
+                                       size_t              budget );
 OYAPI oyDATATYPE_e  OYEXPORT
                  oyArray2d_GetType   ( oyArray2d_s       * array );
 OYAPI const char *  OYEXPORT
@@ -39,6 +39,11 @@ typedef struct oyArray2d_s_ oyArray2d_s_;
 #include "oyArray2d_s.h"
 
 /* Include "Array2d.private.h" { */
+/** alignment in bytes of rows in a oyArray2d_AllocateBlock_() block */
+#define OY_ARRAY2D_ALIGN 64
+/** default byte budget of released blocks kept for reuse,
+ *  see oyArray2d_SetPoolBudget() */
+#define OY_ARRAY2D_POOL_BUDGET (64*1024*1024)
 
 /* } Include "Array2d.private.h" */
 
@@ -72,9 +77,14 @@ oyObject_s           oy_;            /**< Features name and hash. Do not change
                                             - 0 not owned by the object
                                             - 1 one own monolithic memory block
                                                 starting in array2d[0]
-                                            - 2 several owned memory blocks */
+                                            - 2 several owned memory blocks
+                                            - 3 one own aligned memory block
+                                                in block_ with padded rows */
   oyStructList_s     * refs_;          /**< references of other arrays to this*/
   oyArray2d_s        * refered_;       /**< array this one refers to */
+  oyPointer            block_;         /**< start of the aligned memory block for own_lines == 3 */
+  int                  stride_;        /**< bytes from one row to the next; 0 if unknown */
+  size_t               block_size_;    /**< pool bucket size of block_; 0 if not from the pool */
 
 /* } Include "Array2d.members.h" */
 
@@ -104,6 +114,8 @@ oyArray2d_s_ *
                                        oyObject_s          object );
 int
              oyArray2d_ReleaseArray_ ( oyArray2d_s       * obj );
+int          oyArray2d_AllocateBlock_( oyArray2d_s_      * s );
+size_t       oyArray2d_PoolSetBudget_( size_t              budget );
 int              oyArray2d_ToPPM_    ( oyArray2d_s_      * array,
                                        const char        * file_name );
 
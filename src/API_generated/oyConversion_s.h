@@ -43,6 +43,7 @@ typedef struct oyConversion_s oyConversion_s;
 #include "oyProfile_s.h"
 #include "oyFilterNode_s.h"
 #include "oyPixelAccess_s.h"
+#include "oyranos_threads.h"
 
 
 /* Include "Conversion.public.h" { */
@@ -217,6 +218,9 @@ OYAPI int OYEXPORT
 
 
 /* Include "Conversion.public_methods_declarations.h" { */
+OYAPI int  OYEXPORT
+                 oyConversion_Cancel (
+                                       oyConversion_s    * conversion );
 OYAPI int  OYEXPORT
                  oyConversion_Correct (
                                        oyConversion_s    * conversion,
@@ -239,6 +243,27 @@ OYAPI oyConversion_s *  OYEXPORT
                                        oyPixel_t           buf_type_out,
                                        oyOptions_s       * options,
                                        int                 count );
+OYAPI oyConversion_s *  OYEXPORT
+                oyConversion_CreateBasicPixelsFromStrides (
+                                       oyProfile_s       * p_in,
+                                       oyPointer           buf_in,
+                                       int                 stride_in,
+                                       oyPixel_t           buf_type_in,
+                                       oyProfile_s       * p_out,
+                                       oyPointer           buf_out,
+                                       int                 stride_out,
+                                       oyPixel_t           buf_type_out,
+                                       oyOptions_s       * options,
+                                       int                 width,
+                                       int                 height );
+OYAPI oyConversion_s *  OYEXPORT
+                oyConversion_CreateColors (
+                                       oyProfile_s       * p_in,
+                                       oyPixel_t           buf_type_in,
+                                       oyProfile_s       * p_out,
+                                       oyPixel_t           buf_type_out,
+                                       oyOptions_s       * options,
+                                       oyObject_s          obj );
 OYAPI oyConversion_s *  OYEXPORT
                 oyConversion_CreateFromImage (
                                        oyImage_s         * image_in,
@@ -264,14 +289,63 @@ OYAPI int  OYEXPORT
                                        double              x,
                                        double              y,
                                        oyPixelAccess_s   * pixel_access );
+OYAPI char *  OYEXPORT
+                 oyConversion_GetStats (
+                                       oyConversion_s    * conversion,
+                                       oyAlloc_f           allocateFunc );
+OYAPI int  OYEXPORT
+                 oyConversion_RunColors (
+                                       oyConversion_s    * conversion,
+                                       oyPointer           buf_in,
+                                       oyPointer           buf_out,
+                                       int                 count );
 OYAPI int  OYEXPORT
                  oyConversion_RunPixels (
                                        oyConversion_s    * conversion,
                                        oyPixelAccess_s   * pixel_access );
+OYAPI int  OYEXPORT
+                 oyConversion_RunPixelsAsync (
+                                       oyConversion_s    * conversion,
+                                       oyPixelAccess_s   * pixel_access,
+                                       int                 tile_width,
+                                       int                 tile_height,
+                                       oyJob_s          ** job );
+OYAPI int  OYEXPORT
+                 oyConversion_RunPixelsBatch (
+                                       oyConversion_s    * conversion,
+                                       int                 count,
+                                       oyImage_s        ** inputs,
+                                       oyImage_s        ** outputs,
+                                       int                 threads );
+OYAPI int  OYEXPORT
+                 oyConversion_RunPixelsDirty (
+                                       oyConversion_s    * conversion,
+                                       oyPixelAccess_s   * pixel_access,
+                                       int                 threads );
+OYAPI int  OYEXPORT
+                 oyConversion_RunPixelsTiled (
+                                       oyConversion_s    * conversion,
+                                       oyPixelAccess_s   * pixel_access,
+                                       int                 tile_width,
+                                       int                 tile_height,
+                                       int                 threads );
 OYAPI int  OYEXPORT
                  oyConversion_Set  ( oyConversion_s    * conversion,
                                        oyFilterNode_s    * input,
                                        oyFilterNode_s    * output );
+OYAPI int  OYEXPORT
+                 oyConversion_SetImages (
+                                       oyConversion_s    * conversion,
+                                       oyImage_s         * input,
+                                       oyImage_s         * output );
+OYAPI int  OYEXPORT
+                 oyConversion_SetStats (
+                                       oyConversion_s    * conversion,
+                                       int                 enable );
+OYAPI int  OYEXPORT
+                 oyConversion_SetTileCache (
+                                       oyConversion_s    * conversion,
+                                       size_t              bytes );
 OYAPI char *  OYEXPORT
                 oyConversion_ToText (
                                        oyConversion_s    * conversion,
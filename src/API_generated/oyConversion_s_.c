@@ -105,6 +105,8 @@ void oyConversion_Release__Members( oyConversion_s_ * conversion )
   int i,n;
   oyFilterGraph_SetFromNode( g, (oyFilterNode_s*)conversion->input, 0, 0 );
 
+  oyPixelAccess_Release( &conversion->ticket_ );
+  oyStructList_Release( &conversion->tile_cache_ );
   oyFilterNode_Release( (oyFilterNode_s**)&conversion->input );
   oyFilterNode_Release( (oyFilterNode_s**)&conversion->out_ );
 
@@ -192,6 +194,10 @@ int oyConversion_Copy__Members( oyConversion_s_ * dst, oyConversion_s_ * src)
 
   /* Copy each value of src to dst here */
   dst->input = (oyFilterNode_s_*)oyFilterNode_Copy( (oyFilterNode_s*)src->input, dst->oy_ );
+  /* tiles are collected anew */
+  dst->tile_cache_budget_ = src->tile_cache_budget_;
+  if(dst->tile_cache_budget_)
+    dst->tile_cache_ = oyStructList_New( 0 );
 
   return error;
 }
@@ -35,11 +35,15 @@ typedef struct oyConversion_s_ oyConversion_s_;
 
 #include "oyFilterNode_s.h"
 #include "oyFilterNode_s_.h"
+#include "oyPixelAccess_s.h"
+#include "oyStructList_s.h"
   
 
 #include "oyConversion_s.h"
 
 /* Include "Conversion.private.h" { */
+/** pixels per row of a oyConversion_CreateColors() conversion */
+#define OY_CONVERSION_COLORS 32
 
 /* } Include "Conversion.private.h" */
 
@@ -64,6 +68,12 @@ oyObject_s           oy_;            /**< Features name and hash. Do not change
 /* Include "Conversion.members.h" { */
   oyFilterNode_s_    * input;          /**< the input image filter; Most users will start logically with this pice and chain their filters to get the final result. */
   oyFilterNode_s_    * out_;           /**< @private the Oyranos output image. Oyranos will stream the filters starting from the end. This element will be asked on its first plug. */
+  oyPixelAccess_s    * ticket_;        /**< @private prepared job ticket for oyConversion_RunColors() */
+  int                  async_serial_;  /**< @private counter of oyConversion_RunPixelsAsync() jobs */
+  int                  async_canceled_; /**< @private jobs up to this serial are canceled by oyConversion_Cancel() */
+  oyStructList_s     * tile_cache_;    /**< @private oyHash_s entries with results of oyConversion_RunPixels(), most recent last */
+  size_t               tile_cache_budget_; /**< @private bytes for tile_cache_, see oyConversion_SetTileCache() */
+  int                  stats_tile_hits_; /**< @private tile_cache_ hits, see oyConversion_GetStats() */
 
 /* } Include "Conversion.members.h" */
 
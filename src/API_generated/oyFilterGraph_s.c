@@ -31,6 +31,7 @@
 #include "oyCMMapi7_s_.h"
 #include "oyFilterNode_s_.h"
 #include "oyFilterPlug_s_.h"
+#include "oyranos_threads.h"
   
 
 
@@ -295,13 +296,18 @@ OYAPI int OYEXPORT
  *  @memberof oyFilterGraph_s
  *  @brief    Iterate over a filter graph and possibly prepare contexts
  *
+ *  Nodes with distinct context hashes are independent of each other. With
+ *  thread locking set up, see oyThreadLockingSet(), they are prepared
+ *  concurrently. Nodes sharing a hash are prepared afterwards and obtain the
+ *  already cached context.
+ *
  *  @param[in,out] graph               a filter graph
  *  @param[in]     flags               1 - enforce a context preparation
  *  @return                            0 on success, else error
  *
- *  @version Oyranos: 0.1.10
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/17
  *  @since   2009/02/28 (Oyranos: 0.1.10)
- *  @date    2009/03/01
  */
 OYAPI int  OYEXPORT
            oyFilterGraph_PrepareContexts (
@@ -309,13 +315,17 @@ OYAPI int  OYEXPORT
                                        int                 flags )
 {
   oyOption_s * o = 0;
-  oyFilterNode_s_ * node = 0;
+  oyFilterNode_s_ * node = 0,
+                 ** todo = 0;
   oyFilterGraph_s_ * s = (oyFilterGraph_s_*)graph;
-  int i, n, do_it;
+  int i, n, do_it, todo_n = 0, parallel_n = 0;
 
   oyCheckType__m( oyOBJECT_FILTER_GRAPH_S, return 1 )
 
   n = oyFilterNodes_Count( s->nodes );
+  if(n)
+    oyAllocHelper_m_( todo, oyFilterNode_s_*, n, oyAllocateFunc_, return 1 );
+
   for(i = 0; i < n; ++i)
   {
     node = (oyFilterNode_s_*) oyFilterNodes_Get( s->nodes, i );
@@ -328,11 +338,81 @@ OYAPI int  OYEXPORT
     if(do_it &&
        ((oyCMMapi4_s_*)node->core->api4_)->oyCMMFilterNode_ContextToMem &&
        strlen(((oyCMMapi7_s_*)node->api7_)->context_type))
-      oyFilterNode_SetContext_( node, 0 );
+      todo[todo_n++] = node;
+    else
+      oyFilterNode_Release( (oyFilterNode_s**)&node );
+  }
 
-    oyFilterNode_Release( (oyFilterNode_s**)&node );
+#if defined(_OPENMP)
+  /* Move the first node of each context hash to the front. Those build
+   * distinct cache entries and can run side by side. */
+  if(todo_n > 1 && oyThreadLockingReady())
+  {
+    char ** hashs = (char**) oyAllocateFunc_( sizeof(char*) * todo_n );
+    int j;
+
+    if(hashs)
+    {
+      for(i = 0; i < todo_n; ++i)
+        hashs[i] = oyFilterNode_GetHashText_( todo[i], 4 );
+
+      for(i = 0; i < todo_n; ++i)
+      {
+        char * h = hashs[i];
+
+        for(j = 0; h && j < parallel_n; ++j)
+          if(strcmp( h, hashs[j] ) == 0)
+            break;
+        if(h && j == parallel_n)
+        {
+          node = todo[i];
+          for(j = i; j > parallel_n; --j)
+          {
+            todo[j] = todo[j-1];
+            hashs[j] = hashs[j-1];
+          }
+          todo[parallel_n] = node;
+          hashs[parallel_n++] = h;
+        }
+      }
+      node = 0;
+
+      for(i = 0; i < todo_n; ++i)
+        if(hashs[i]) oyDeAllocateFunc_( hashs[i] );
+      oyDeAllocateFunc_( hashs );
+    }
+  }
+  if(parallel_n < 2)
+    parallel_n = 0;
+
+#pragma omp parallel for schedule(dynamic)
+#endif
+  for(i = 0; i < parallel_n; ++i)
+  {
+    double trace = oyTraceBegin();
+
+    oyFilterNode_SetContext_( todo[i], 0 );
+
+    if(trace)
+      oyTraceEnd( trace, todo[i]->api7_->registration, "context", -1 );
+  }
+
+  /* remaining nodes hit the cache filled above */
+  for(i = parallel_n; i < todo_n; ++i)
+  {
+    double trace = oyTraceBegin();
+
+    oyFilterNode_SetContext_( todo[i], 0 );
+
+    if(trace)
+      oyTraceEnd( trace, todo[i]->api7_->registration, "context", -1 );
   }
 
+  for(i = 0; i < todo_n; ++i)
+    oyFilterNode_Release( (oyFilterNode_s**)&todo[i] );
+  if(todo)
+    oyDeAllocateFunc_( todo );
+
   /* clean the graph */
   o = oyOptions_Find( s->options, "dirty", oyNAME_PATTERN );
   oyOption_SetFromString( o, "false", 0 );
@@ -242,6 +242,9 @@ OYAPI int  OYEXPORT
                                        oyStruct_s        * data,
                                        int                 socket_pos,
                                        oyObject_s        * object );
+OYAPI int  OYEXPORT
+                 oyFilterNode_SetDirty(oyFilterNode_s    * node,
+                                       oyRectangle_s     * pixels );
 OYAPI int  OYEXPORT
                  oyFilterNode_Disconnect (
                                        oyFilterNode_s    * node,
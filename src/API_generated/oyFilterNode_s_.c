@@ -205,6 +205,8 @@ void oyFilterNode_Release__Members( oyFilterNode_s_ * filternode )
     filternode->sockets = NULL;
     if(filternode->plugs) deallocateFunc(filternode->plugs);
     filternode->plugs = NULL;
+    if(filternode->stats_) deallocateFunc(filternode->stats_);
+    filternode->stats_ = NULL;
   }
 
   if(oy_debug_objects >= 0)
@@ -754,7 +756,24 @@ int oyFilterNode_Release_( oyFilterNode_s_ **filternode )
 
 /* Include "FilterNode.private_methods_definitions.c" { */
 #include "oyranos_conversion_internal.h"
+#include "oyranos_io.h"
+#include "oyranos_version.h"
+#include "oyArray2d_s_.h"
 #include "oyCMMapi9_s_.h"
+#include "oyPixelAccess_s_.h"
+
+#if defined(_WIN32)
+# include <sys/utime.h>
+#else
+# include <unistd.h>
+# include <utime.h>
+#endif
+
+int (*oyFilterNode_ImageAddDirty_p_) ( oyImage_s         * image,
+                                       oyRectangle_s     * pixels ) = NULL;
+int (*oyFilterNode_RoiToPixels_p_)   ( oyPixelAccess_s   * ticket,
+                                       oyRectangle_s     * roi,
+                                       oyRectangle_s    ** pixels ) = NULL;
 
 /** Function  oyFilterNode_AddToAdjacencyLst_
  *  @memberof oyFilterNode_s
@@ -820,14 +839,77 @@ int  oyFilterNode_AddToAdjacencyLst_ ( oyFilterNode_s_    * s,
   return 0;
 }
 
-oyHash_s *   oyFilterNode_GetHash_   ( oyFilterNode_s_   * node,
+/** Function  oyFilterNode_RunStats_
+ *  @memberof oyFilterNode_s
+ *  @brief    Run a node and update its counters
+ *  @internal
+ *
+ *  The time covers the input nodes, which are called from inside the node.
+ *  Arrays, which appear in the ticket during the run, count as allocated.
+ *
+ *  @param[in]     node                the node with stats_
+ *  @param[in]     plug                the requesting plug
+ *  @param[in,out] ticket              the job ticket
+ *  @return                            the oyCMMapi7_Run() error
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/16
+ *  @since   2026/10/16 (Oyranos: 0.9.7)
+ */
+int          oyFilterNode_RunStats_  ( oyFilterNode_s_    * node,
+                                       oyFilterPlug_s     * plug,
+                                       oyPixelAccess_s    * ticket )
+{
+  oyFilterNodeStats_s_ * stats = node->stats_;
+  oyPixelAccess_s_ * ticket_ = (oyPixelAccess_s_*)ticket;
+  oyArray2d_s_ * a = ticket_ ? (oyArray2d_s_*)ticket_->array : NULL, * b;
+  oyRectangle_s * pixels = NULL;
+  double seconds = oySeconds(), bytes = 0, n = 0;
+  int error;
+
+  error = oyCMMapi7_Run( (oyCMMapi7_s*) node->api7_, plug, ticket );
+  seconds = oySeconds() - seconds;
+
+  /* the arrays are only compared and read; no references are taken */
+  b = ticket_ ? (oyArray2d_s_*)ticket_->array : NULL;
+  if(b && b != a)
+    bytes = (double)b->width * b->height * oyDataTypeGetSize( b->t );
+  if(ticket && oyFilterNode_RoiToPixels_p_ &&
+     oyFilterNode_RoiToPixels_p_( ticket, NULL, &pixels ) <= 0)
+    n = oyRectangle_GetGeo1( pixels, 2 ) * oyRectangle_GetGeo1( pixels, 3 );
+
+  oyObject_Lock( node->oy_, __FILE__, __LINE__ );
+  ++stats->calls;
+  stats->seconds += seconds;
+  stats->pixels += n;
+  stats->bytes += bytes;
+  oyObject_UnLock( node->oy_, __FILE__, __LINE__ );
+
+  oyRectangle_Release( &pixels );
+
+  return error;
+}
+
+/** Function  oyFilterNode_GetHashText_
+ *  @memberof oyFilterNode_s
+ *  @brief    Get the text to identify a nodes context
+ *  @internal
+ *
+ *  @param[in]     node                the node
+ *  @param[in]     api                 4 or 7 for the context type
+ *  @return                            the text, allocated by oyAllocateFunc_
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/16
+ *  @since   2026/10/16 (Oyranos: 0.9.7)
+ */
+char *       oyFilterNode_GetHashText_(oyFilterNode_s_   * node,
                                        int                 api )
 {
   oyFilterCore_s_ * core_ = node->core;
   const char * hash_text_ = 0;
   char * hash_text = 0,
        * hash_temp = 0;
-  oyHash_s * hash = 0;
 
   /* create hash text */
   if(core_->api4_->oyCMMFilterNode_GetText)
@@ -846,6 +928,17 @@ oyHash_s *   oyFilterNode_GetHash_   ( oyFilterNode_s_   * node,
     oyStringAddPrintf_( &hash_text, oyAllocateFunc_, oyDeAllocateFunc_,
                         "%s:%s", core_->api4_->context_type, hash_text_ );
 
+  if(hash_temp) oyDeAllocateFunc_(hash_temp);
+
+  return hash_text;
+}
+
+oyHash_s *   oyFilterNode_GetHash_   ( oyFilterNode_s_   * node,
+                                       int                 api )
+{
+  char * hash_text = oyFilterNode_GetHashText_( node, api );
+  oyHash_s * hash = 0;
+
   /* query in cache for api7 */
   hash = oyCMMCacheListGetEntry_( hash_text );
 
@@ -855,7 +948,6 @@ oyHash_s *   oyFilterNode_GetHash_   ( oyFilterNode_s_   * node,
                      OY_DBG_ARGS_,
                      api, hash_text );
 
-  if(hash_temp) oyDeAllocateFunc_(hash_temp);
   if(hash_text) oyDeAllocateFunc_(hash_text);
 
   return hash;
@@ -976,6 +1068,247 @@ void *       oyFilterNode_ContextToMem_
   return ptr;
 }
 
+/* bytes of the device link disk cache, OY_DL_CACHE_SIZE=0 disables it */
+static size_t oyFilterNode_DiskCacheLimit_( void )
+{
+  const char * env = getenv( "OY_DL_CACHE_SIZE" );
+
+  if(env)
+    return (size_t) strtoul( env, NULL, 10 );
+
+  return OY_DL_DISK_CACHE_SIZE;
+}
+
+/* full file name of a context inside the user device link cache */
+static char *  oyFilterNode_DiskCacheName_ (
+                                       oyFilterNode_s_    * node,
+                                       const char         * hash_text )
+{
+  unsigned char md5[16] = {0};
+  char * dir, * name = NULL;
+  int i;
+
+  dir = oyResolveDirFileName_( OS_DL_CACHE_USER_DIR );
+  if(!dir)
+    return NULL;
+
+  oyMiscBlobGetMD5_( hash_text, strlen(hash_text), md5 );
+  oyStringAddPrintf_( &name, oyAllocateFunc_, oyDeAllocateFunc_,
+                      "%s" OY_SLASH, dir );
+  for(i = 0; i < 16; ++i)
+    oyStringAddPrintf_( &name, oyAllocateFunc_, oyDeAllocateFunc_,
+                        "%02x", md5[i] );
+  oyStringAddPrintf_( &name, oyAllocateFunc_, oyDeAllocateFunc_,
+                      ".%s", node->core->api4_->context_type );
+  oyFree_m_( dir );
+
+  return name;
+}
+
+/* file header without the sizes line; bound to the Oyranos version and
+ * to the module build by oyCMMapiCacheId_() */
+static char *  oyFilterNode_DiskCacheHeader_ (
+                                       oyFilterNode_s_    * node )
+{
+  char * header = NULL,
+       * module = oyCMMapiCacheId_( (oyCMMapi_s*)node->core->api4_ );
+
+  oyStringAddPrintf_( &header, oyAllocateFunc_, oyDeAllocateFunc_,
+                      OY_DL_DISK_CACHE_FORMAT "\n%s\n%s",
+                      OYRANOS_VERSION_NAME, oyNoEmptyString_m_(module) );
+  if(module)
+    oyFree_m_( module );
+  return header;
+}
+
+/** Function  oyFilterNode_ContextFromDisk_
+ *  @memberof oyFilterNode_s
+ *  @brief    Look up a api4 context in the user device link cache
+ *  @internal
+ *
+ *  The context is searched in the oyPATH_CACHE directory. Files from other
+ *  Oyranos versions, modules or module versions are removed. A found file is touched to
+ *  keep it during oyFilterNode_ContextToDisk_() cleanup.
+ *
+ *  @param[in]     node                filter
+ *  @param[in]     hash_text           oyFilterNode_GetHashText_( node, 4 )
+ *  @param[out]    size                context size
+ *  @return                            the context or NULL
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/16
+ *  @since   2026/10/16 (Oyranos: 0.9.7)
+ */
+oyPointer    oyFilterNode_ContextFromDisk_ (
+                                       oyFilterNode_s_    * node,
+                                       const char         * hash_text,
+                                       size_t             * size )
+{
+  char * file_name, * header, * mem = NULL;
+  size_t mem_size = 0, header_len;
+  unsigned long text_len = 0, blob_size = 0;
+  oyPointer ptr = NULL;
+
+  if(!hash_text || !node->core->api4_->context_type[0] ||
+     !oyFilterNode_DiskCacheLimit_())
+    return NULL;
+
+  file_name = oyFilterNode_DiskCacheName_( node, hash_text );
+  if(!file_name || !oyIsFile_( file_name ))
+  {
+    if(file_name)
+      oyFree_m_( file_name );
+    return NULL;
+  }
+
+  header = oyFilterNode_DiskCacheHeader_( node );
+  header_len = strlen( header );
+  mem = oyReadFileToMem_( file_name, &mem_size, oyAllocateFunc_ );
+
+  if(mem && mem_size > header_len &&
+     memcmp( mem, header, header_len ) == 0 &&
+     sscanf( mem + header_len, "%lu %lu", &text_len, &blob_size ) == 2)
+  {
+    const char * data = memchr( mem + header_len, '\n',
+                                mem_size - header_len );
+    if(data++ &&
+       (size_t)(data - mem) + text_len + blob_size == mem_size &&
+       text_len == strlen( hash_text ) &&
+       memcmp( data, hash_text, text_len ) == 0)
+    {
+      ptr = oyAllocateFunc_( blob_size );
+      if(ptr)
+      {
+        memcpy( ptr, data + text_len, blob_size );
+        *size = blob_size;
+      }
+    }
+  }
+
+  if(ptr)
+    /* mark as recently used */
+    utime( file_name, NULL );
+  else if(mem)
+    /* outdated or broken */
+    oyRemoveFile_( file_name );
+
+  if(oy_debug)
+    oyMessageFunc_p( oyMSG_DBG, (oyStruct_s*) node, OY_DBG_FORMAT_
+                     "%s disk cache: %s", OY_DBG_ARGS_,
+                     ptr ? "found in" : "removed from", file_name );
+
+  if(mem)
+    oyFree_m_( mem );
+  oyFree_m_( header );
+  oyFree_m_( file_name );
+
+  return ptr;
+}
+
+/** Function  oyFilterNode_ContextToDisk_
+ *  @memberof oyFilterNode_s
+ *  @brief    Store a api4 context in the user device link cache
+ *  @internal
+ *
+ *  The file is written under a temporary name and then renamed, so that
+ *  other processes never read partial files. Afterwards the least recently
+ *  used files of the same context type are removed, until they fit into
+ *  OY_DL_DISK_CACHE_SIZE or the OY_DL_CACHE_SIZE environment variable in
+ *  bytes. Other files in the directory are not touched.
+ *
+ *  @param[in]     node                filter
+ *  @param[in]     hash_text           oyFilterNode_GetHashText_( node, 4 )
+ *  @param[in]     ptr                 context
+ *  @param[in]     size                context size
+ *  @return                            error
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/16
+ *  @since   2026/10/16 (Oyranos: 0.9.7)
+ */
+int          oyFilterNode_ContextToDisk_ (
+                                       oyFilterNode_s_    * node,
+                                       const char         * hash_text,
+                                       oyPointer            ptr,
+                                       size_t               size )
+{
+  size_t limit = oyFilterNode_DiskCacheLimit_(), text_len, header_len;
+  char * file_name, * tmp_name = NULL, * header;
+  char * mem;
+  int error;
+
+  if(!hash_text || !ptr || !size || !node->core->api4_->context_type[0] ||
+     !limit || size > limit)
+    return -1;
+
+  file_name = oyFilterNode_DiskCacheName_( node, hash_text );
+  if(!file_name)
+    return 1;
+
+  text_len = strlen( hash_text );
+  header = oyFilterNode_DiskCacheHeader_( node );
+  oyStringAddPrintf_( &header, oyAllocateFunc_, oyDeAllocateFunc_,
+                      "%lu %lu\n", (unsigned long)text_len,
+                      (unsigned long)size );
+  header_len = strlen( header );
+
+  mem = oyAllocateFunc_( header_len + text_len + size );
+  error = !mem;
+  if(!error)
+  {
+    memcpy( mem, header, header_len );
+    memcpy( mem + header_len, hash_text, text_len );
+    memcpy( mem + header_len + text_len, ptr, size );
+
+    oyStringAddPrintf_( &tmp_name, oyAllocateFunc_, oyDeAllocateFunc_,
+                        "%s.%d-%d.tmp", file_name, (int)OY_GETPID(),
+                        oyObject_GetId( node->oy_ ) );
+    error = oyWriteMemToFile_( tmp_name, mem, header_len + text_len + size );
+#if defined(_WIN32)
+    if(!error)
+      oyRemoveFile_( file_name );
+#endif
+    if(!error)
+      error = rename( tmp_name, file_name );
+    if(error)
+      oyRemoveFile_( tmp_name );
+    oyFree_m_( tmp_name );
+    oyFree_m_( mem );
+  }
+
+  if(!error)
+  {
+    /* trim only own files of this context type */
+    char * suffix = NULL;
+    oyStringAddPrintf_( &suffix, oyAllocateFunc_, oyDeAllocateFunc_,
+                        ".%s", node->core->api4_->context_type );
+    oyCacheDirTrim_( OS_DL_CACHE_USER_DIR, suffix, limit );
+    oyFree_m_( suffix );
+  }
+
+  if(oy_debug)
+    oyMessageFunc_p( oyMSG_DBG, (oyStruct_s*) node, OY_DBG_FORMAT_
+                     "wrote %s to disk cache: %d", OY_DBG_ARGS_,
+                     file_name, error );
+
+  oyFree_m_( header );
+  oyFree_m_( file_name );
+
+  return error;
+}
+
+/* count a context from the cache (hit = 1) or from the module (hit = 0) */
+static void  oyFilterNode_StatsCache_( oyFilterNode_s_    * node,
+                                       int                  hit )
+{
+  oyObject_Lock( node->oy_, __FILE__, __LINE__ );
+  if(hit)
+    ++node->stats_->cache_hits;
+  else
+    ++node->stats_->cache_misses;
+  oyObject_UnLock( node->oy_, __FILE__, __LINE__ );
+}
+
 /** Function  oyFilterNode_SetContext_
  *  @memberof oyFilterNode_s
  *  @brief    Set module context in a filter
@@ -1098,6 +1431,8 @@ int          oyFilterNode_SetContext_( oyFilterNode_s_    * node,
             /* 3. check and 3.a take*/
             cmm_ptr7 = (oyPointer_s*) oyHash_GetPointer( hash7,
                                                          oyOBJECT_POINTER_S);
+            if(node->stats_ && !blob && cmm_ptr7 && oyPointer_GetPointer(cmm_ptr7))
+              oyFilterNode_StatsCache_( node, 1 );
 
             if(!(cmm_ptr7 && oyPointer_GetPointer(cmm_ptr7)) || blob)
             {
@@ -1127,11 +1462,24 @@ int          oyFilterNode_SetContext_( oyFilterNode_s_    * node,
                 cmm_ptr4 = oyPointer_New(0);
               }
 
+              if(node->stats_)
+                oyFilterNode_StatsCache_( node,
+                                          oyPointer_GetPointer(cmm_ptr4) != 0 );
+
               if(!oyPointer_GetPointer(cmm_ptr4))
               {
+                char * hash_text4 = oyFilterNode_GetHashText_( node, 4 );
+                int from_disk;
+
                 size = 0;
-                /* 3b. ask CMM */
-                ptr = oyFilterNode_ContextToMem_( node, &size, oyAllocateFunc_);
+                /* 3b. look into the disk cache of former processes */
+                ptr = oyFilterNode_ContextFromDisk_( node, hash_text4, &size );
+                from_disk = ptr != NULL;
+
+                /* 3c. ask CMM */
+                if(!ptr)
+                  ptr = oyFilterNode_ContextToMem_( node, &size,
+                                                    oyAllocateFunc_ );
 
                 if(!ptr || !size)
                 {
@@ -1156,6 +1504,7 @@ int          oyFilterNode_SetContext_( oyFilterNode_s_    * node,
                       OY_DBG_FORMAT_ "no device link for caching\n%s",
                       OY_DBG_ARGS_,
                       oyFilterNode_GetText( (oyFilterNode_s*)node,oyNAME_NICK));
+                      if(hash_text4) oyFree_m_( hash_text4 );
                       goto clean;
                     } else
                       core_ = node->core;
@@ -1201,7 +1550,19 @@ int          oyFilterNode_SetContext_( oyFilterNode_s_    * node,
 
                   /* 3b.2. update cmm4 cache entry */
                   error = oyHash_SetPointer( hash4, (oyStruct_s*) cmm_ptr4);
+
+                  /* 3b.3. keep for the next process, if the CMM left the
+                   *       options as they were looked up */
+                  if(!from_disk)
+                  {
+                    char * t = oyFilterNode_GetHashText_( node, 4 );
+                    if(t && oyStrcmp_( t, hash_text4 ) == 0)
+                      oyFilterNode_ContextToDisk_( node, hash_text4, ptr,
+                                                   size );
+                    if(t) oyFree_m_( t );
+                  }
                 }
+                if(hash_text4) oyFree_m_( hash_text4 );
               }
 
 
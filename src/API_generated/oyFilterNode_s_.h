@@ -46,6 +46,37 @@ typedef struct oyFilterNode_s_ oyFilterNode_s_;
 #include "oyFilterNode_s.h"
 
 /* Include "FilterNode.private.h" { */
+/** @internal
+ *  @brief   execution counters of a node, see oyConversion_SetStats() */
+typedef struct {
+  int          calls;                  /**< oyFilterNode_Run() calls */
+  double       seconds;                /**< wall time including input nodes */
+  double       pixels;                 /**< pixels requested by the tickets */
+  double       bytes;                  /**< pixel arrays attached to tickets */
+  int          cache_hits;             /**< contexts from the Oyranos cache */
+  int          cache_misses;           /**< contexts created by a module */
+} oyFilterNodeStats_s_;
+
+/** @internal
+ *  @brief   first line of a device link disk cache file */
+#define OY_DL_DISK_CACHE_FORMAT "oyranos-device-link-cache 2"
+/** @internal
+ *  @brief   default bytes of the device link disk cache; see OY_DL_CACHE_SIZE */
+#define OY_DL_DISK_CACHE_SIZE (64 * 1024 * 1024)
+
+/** @internal
+ *  @brief   libOyranos functions used inside libOyranosModules
+ *
+ *  libOyranosModules does not link against libOyranos. oyImage_New()
+ *  registers oyImage_AddDirty() for oyFilterNode_SetDirty() and
+ *  oyConversion_SetStats() registers oyPixelAccess_RoiToPixels() for
+ *  oyFilterNode_RunStats_().
+ */
+extern int (*oyFilterNode_ImageAddDirty_p_) ( oyImage_s         * image,
+                                              oyRectangle_s     * pixels );
+extern int (*oyFilterNode_RoiToPixels_p_)   ( oyPixelAccess_s   * ticket,
+                                              oyRectangle_s     * roi,
+                                              oyRectangle_s    ** pixels );
 
 /* } Include "FilterNode.private.h" */
 
@@ -83,6 +114,7 @@ oyObject_s           oy_;            /**< Features name and hash. Do not change
   oyPointer_s        * backend_data;
   /** the processing function and node connector descriptions */
   oyCMMapi7_s_       * api7_;
+  oyFilterNodeStats_s_ * stats_;      /**< @private counters, see oyConversion_SetStats() */
 
 /* } Include "FilterNode.members.h" */
 
@@ -106,8 +138,22 @@ int  oyFilterNode_AddToAdjacencyLst_ ( oyFilterNode_s_    * s,
                                        oyFilterPlugs_s_   * edges,
                                        const char         * mark,
                                        int                  flags );
+int          oyFilterNode_RunStats_  ( oyFilterNode_s_    * node,
+                                       oyFilterPlug_s     * plug,
+                                       oyPixelAccess_s    * ticket );
+oyPointer    oyFilterNode_ContextFromDisk_ (
+                                       oyFilterNode_s_    * node,
+                                       const char         * hash_text,
+                                       size_t             * size );
+int          oyFilterNode_ContextToDisk_ (
+                                       oyFilterNode_s_    * node,
+                                       const char         * hash_text,
+                                       oyPointer            ptr,
+                                       size_t               size );
 int          oyFilterNode_SetContext_( oyFilterNode_s_    * node,
                                        oyBlob_s_          * blob );
+char *       oyFilterNode_GetHashText_(oyFilterNode_s_   * node,
+                                       int                 api );
 oyStructList_s * oyFilterNode_GetData_(oyFilterNode_s_    * node,
                                        int                  get_plug );
 oyFilterNode_s *   oyFilterNode_GetLastFromLinear_ (
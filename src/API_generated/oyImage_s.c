@@ -107,6 +107,7 @@ OYAPI int OYEXPORT
 #include "oyFilterNode_s.h"
 #include "oyConversion_s.h"
 #include "oyranos_image_internal.h"
+#include "oyranos_threads.h"
 
 /**
  *  Function oyImage_GetArray2dPointContinous
@@ -412,6 +413,160 @@ oyImage_s *    oyImage_Create         ( int               width,
   return (oyImage_s*) s;
 }
 
+/** @brief   Create a image around strided pixel memory
+ *  @memberof oyImage_s
+ *
+ *  The rows of the image point directly into the pixels memory. No copy
+ *  is done. So frames from video or GUI toolkits with padded rows can be
+ *  used as conversion input and output as is. A negative stride describes
+ *  bottom-up memory; pixels points then to the top row, which is the last
+ *  row in memory.
+ *
+    @param[in]    width        image width
+    @param[in]    height       image height
+    @param[in]    pixels       pointer to the first (top) row
+    @param[in]    stride       bytes from one row to the next; 0 means
+                               tightly packed, negative means bottom-up
+    @param[in]    own_pixels   - 0 : the pixels remain in the responsibility
+                                 of the user
+                               - 1 : the image releases the pixels with its
+                                 deallocator; the memory block starts at
+                                 the lowest row; without a returned
+                                 image the pixels stay with the user
+    @param[in]    pixel_layout i.e. oyTYPE_123_16 for 16-bit RGB data;
+                               interleaved layouts only
+    @param[in]    profile      color space description
+    @param[in]    object       the optional base
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/16
+ *  @since   2026/10/16 (Oyranos: 0.9.7)
+ */
+oyImage_s *    oyImage_CreateFromStride (
+                                       int                 width,
+                                       int                 height,
+                                       oyPointer           pixels,
+                                       int                 stride,
+                                       int                 own_pixels,
+                                       oyPixel_t           pixel_layout,
+                                       oyProfile_s       * profile,
+                                       oyObject_s          object )
+{
+  oyImage_s_ * s = NULL;
+  int error = 0;
+
+  if(!pixels)
+  {
+    WARNc_S("no pixels obtained");
+    return NULL;
+  }
+
+  if(oyToPlanar_m( pixel_layout ))
+  {
+    WARNc_S("planar pixel layout not supported");
+    return NULL;
+  }
+
+  /* the rows are placed by oyArray2d_SetDataStride() afterwards */
+  s = (oyImage_s_*) oyImage_Create( width, height, pixels, pixel_layout,
+                                    profile, object );
+  error = !s || !s->pixel_data;
+
+  if(error <= 0)
+    error = oyArray2d_SetDataStride( (oyArray2d_s*)s->pixel_data, pixels,
+                                     stride, own_pixels );
+
+  if(error > 0)
+    oyImage_Release( (oyImage_s**)&s );
+
+  return (oyImage_s*) s;
+}
+
+/** @brief   Create a image with line accessors and without pixel buffer
+ *  @memberof oyImage_s
+ *
+ *  The image does not allocate pixel memory. Lines are pulled by
+ *  getLine and pushed by setLine. A getLine implementation can return
+ *  newly allocated lines and set is_allocated, then the caller will
+ *  release them with the images deallocator. That way image data can be
+ *  streamed from and to files or devices in bands of lines.
+ *  oyConversion_RunPixelsTiled() with full width tiles and one thread
+ *  processes such images from top to bottom.
+ *
+ *  The pixel_data can be obtained inside the accessors by
+ *  oyImage_GetPixelData().
+ *
+    @param[in]    width        image width
+    @param[in]    height       image height
+    @param[in]    pixel_layout i.e. oyTYPE_123_16 for 16-bit RGB data
+    @param[in]    profile      color space description
+    @param[in,out] pixel_data  user context for the line accessors; will be
+                               moved in
+    @param[in]    getLine      line reader, for input images
+    @param[in]    setLine      line writer, for output images
+    @param[in]    object       the optional base
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/16
+ *  @since   2026/10/16 (Oyranos: 0.9.7)
+ */
+oyImage_s *    oyImage_CreateFromLines(int                 width,
+                                       int                 height,
+                                       oyPixel_t           pixel_layout,
+                                       oyProfile_s       * profile,
+                                       oyStruct_s       ** pixel_data,
+                                       oyImage_GetLine_f   getLine,
+                                       oyImage_SetLine_f   setLine,
+                                       oyObject_s          object )
+{
+  oyRectangle_s * display_rectangle = 0;
+  oyImage_s_ * s = 0;
+  int error = !profile || !pixel_data || !*pixel_data ||
+              (!getLine && !setLine);
+
+  if(error)
+  {
+    WARNc_S("need profile, pixel_data and line accessor");
+    return (oyImage_s*) s;
+  }
+
+  s = oyImage_New_(object);
+  if(!s)
+  {
+    WARNc_S("Allocating image failed");
+    return (oyImage_s*) s;
+  }
+
+  s->width = width;
+  s->height = height;
+  s->profile_ = oyProfile_Copy( profile, 0 );
+  if(s->width != 0.0)
+    s->viewport = oyRectangle_NewWith( 0, 0, 1.0,
+                                   (double)s->height/(double)s->width, s->oy_ );
+
+  error = oyImage_CombinePixelLayout2Mask_ ( s, pixel_layout );
+
+  if(error <= 0)
+    error = oyImage_SetData( (oyImage_s*)s, pixel_data, 0, getLine, 0,
+                             0, setLine, 0 );
+
+  if(error <= 0)
+  {
+    display_rectangle = oyRectangle_New( 0 );
+
+    error = !display_rectangle;
+    if(error <= 0)
+      oyOptions_MoveInStruct( &s->tags,
+                              "//imaging/output/display_rectangle",
+                              (oyStruct_s**)&display_rectangle, OY_CREATE_NEW );
+  }
+
+  if(error > 0)
+    oyImage_Release( (oyImage_s**)&s );
+
+  return (oyImage_s*) s;
+}
+
 /** @brief   collect infos about a image for showing one a display
  *  @memberof oyImage_s
 
@@ -668,7 +823,11 @@ static int oyImage_CreateFillArray_  ( oyImage_s         * image,
       if(!error)
       {
         /* allocate each single line */
-        if(allocate_method == 1 || allocate_method == 2)
+        if((allocate_method == 1 || allocate_method == 2) &&
+           a->own_lines == 0 && !a->array2d[0])
+          /* a fresh array gets one cache aligned block */
+          error = oyArray2d_AllocateBlock_( a );
+        else if(allocate_method == 1 || allocate_method == 2)
         {
           a->own_lines = 2;
 
@@ -775,6 +934,7 @@ int            oyImage_FillArray     ( oyImage_s         * image,
   unsigned char * line_data = 0;
   int i,j, height, channels_n;
   size_t wlen;
+  double trace = oyTraceBegin();
 
   if(!image)
     return 1;
@@ -942,6 +1102,10 @@ int            oyImage_FillArray     ( oyImage_s         * image,
           error = !memcpy( dst, src, wlen );
       }
 
+      /* streamed lines are owned by us */
+      if(line_data && is_allocated)
+        image->oy_->deallocateFunc_( line_data );
+
       i += height;
 
       if(error) break;
@@ -990,6 +1154,9 @@ int            oyImage_FillArray     ( oyImage_s         * image,
 
   *array = (oyArray2d_s*)a;
 
+  if(trace)
+    oyTraceEnd( trace, "oyImage_FillArray", "image", -1 );
+
   return error;
 }
 
@@ -1027,6 +1194,7 @@ int            oyImage_ReadArray     ( oyImage_s         * image,
                  * arc = &array_rect_chan;
   oyDATATYPE_e data_type = oyUINT8;
   int bps = 0, channel_n, i, offset, width, height;
+  double trace = oyTraceBegin();
 
   if(error)
     return 0;
@@ -1129,9 +1297,184 @@ int            oyImage_ReadArray     ( oyImage_s         * image,
     }
   }
 
+  if(trace)
+    oyTraceEnd( trace, "oyImage_ReadArray", "image", -1 );
+
   return error;
 }
 
+/** Function  oyImage_AddDirty
+ *  @memberof oyImage_s
+ *  @brief    Mark a pixel region as changed
+ *
+ *  The image keeps a small set of dirty rectangles. For the output image
+ *  of a conversion they tell, which pixels need a new computation through
+ *  oyConversion_RunPixelsDirty(). oyFilterNode_SetDirty() marks the output
+ *  images behind a changed node.
+ *
+ *  The rectangle is trimmed to the image and widened to full pixels.
+ *  Overlapping rectangles are merged into their bounding box. With
+ *  OY_IMAGE_DIRTY_MAX rectangles in the set all are merged into one.
+ *
+ *  @param[in,out] image               the image
+ *  @param[in]     pixels              the changed region in pixel;
+ *                                     NULL marks the whole image
+ *  @return                            0 on success, else error
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/16
+ *  @since   2026/10/16 (Oyranos: 0.9.7)
+ */
+int            oyImage_AddDirty      ( oyImage_s         * image,
+                                       oyRectangle_s     * pixels )
+{
+  oyImage_s_ * s = (oyImage_s_*)image;
+  oyRectangle_s_ * r, * d;
+  oyRectangle_s_ whole = {oyOBJECT_RECTANGLE_S, 0,0,0, 0,0,0,0};
+  double x1, y1;
+  int i, merged = 1, collapse;
+
+  if(!s)
+    return 1;
+
+  oyCheckType__m( oyOBJECT_IMAGE_S, return 1 )
+
+  oyRectangle_SetGeo( (oyRectangle_s*)&whole, 0,0, s->width, s->height );
+  if(pixels)
+    r = (oyRectangle_s_*) oyRectangle_NewFrom( pixels, s->oy_ );
+  else
+    r = (oyRectangle_s_*) oyRectangle_NewFrom( (oyRectangle_s*)&whole, s->oy_ );
+  if(!r)
+    return 1;
+
+  /* whole pixels inside the image */
+  oyRectangle_Normalise( (oyRectangle_s*)r );
+  x1 = ceil( r->x + r->width );
+  y1 = ceil( r->y + r->height );
+  r->x = floor( r->x );
+  r->y = floor( r->y );
+  r->width = x1 - r->x;
+  r->height = y1 - r->y;
+  oyRectangle_Trim( (oyRectangle_s*)r, (oyRectangle_s*)&whole );
+
+  if(r->width <= 0 || r->height <= 0)
+  {
+    oyRectangle_Release( (oyRectangle_s**)&r );
+    return 0;
+  }
+
+  if(!s->dirty_)
+    s->dirty_ = oyStructList_New( 0 );
+
+  collapse = oyStructList_Count( s->dirty_ ) >= OY_IMAGE_DIRTY_MAX;
+
+  /* a merged box might touch further rectangles */
+  while(merged)
+  {
+    merged = 0;
+    for(i = oyStructList_Count( s->dirty_ ) - 1; i >= 0; --i)
+    {
+      d = (oyRectangle_s_*) oyStructList_GetRefType( s->dirty_, i,
+                                                     oyOBJECT_RECTANGLE_S );
+      if(d && (collapse ||
+          (d->x < r->x + r->width && r->x < d->x + d->width &&
+           d->y < r->y + r->height && r->y < d->y + d->height)))
+      {
+        x1 = OY_MAX( d->x + d->width, r->x + r->width );
+        y1 = OY_MAX( d->y + d->height, r->y + r->height );
+        r->x = OY_MIN( d->x, r->x );
+        r->y = OY_MIN( d->y, r->y );
+        r->width = x1 - r->x;
+        r->height = y1 - r->y;
+        oyStructList_ReleaseAt( s->dirty_, i );
+        merged = 1;
+      }
+      oyRectangle_Release( (oyRectangle_s**)&d );
+    }
+  }
+
+  return oyStructList_MoveIn( s->dirty_, (oyStruct_s**)&r, -1, 0 );
+}
+
+/** Function  oyImage_CountDirty
+ *  @memberof oyImage_s
+ *  @brief    Count dirty rectangles
+ *
+ *  @param[in]     image               the image
+ *  @return                            number of rectangles from
+ *                                     oyImage_AddDirty(); 0 - clean
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/16
+ *  @since   2026/10/16 (Oyranos: 0.9.7)
+ */
+int            oyImage_CountDirty    ( oyImage_s         * image )
+{
+  oyImage_s_ * s = (oyImage_s_*)image;
+
+  if(!s)
+    return 0;
+
+  oyCheckType__m( oyOBJECT_IMAGE_S, return 0 )
+
+  return oyStructList_Count( s->dirty_ );
+}
+
+/** Function  oyImage_GetDirty
+ *  @memberof oyImage_s
+ *  @brief    Get a dirty rectangle
+ *
+ *  @param[in]     image               the image
+ *  @param[in]     pos                 position in the dirty set
+ *  @return                            a copy of the rectangle in pixel
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/16
+ *  @since   2026/10/16 (Oyranos: 0.9.7)
+ */
+oyRectangle_s* oyImage_GetDirty      ( oyImage_s         * image,
+                                       int                 pos )
+{
+  oyImage_s_ * s = (oyImage_s_*)image;
+  oyRectangle_s * r, * copy = NULL;
+
+  if(!s)
+    return NULL;
+
+  oyCheckType__m( oyOBJECT_IMAGE_S, return NULL )
+
+  r = (oyRectangle_s*) oyStructList_GetRefType( s->dirty_, pos,
+                                                oyOBJECT_RECTANGLE_S );
+  if(r)
+    copy = oyRectangle_NewFrom( r, NULL );
+  oyRectangle_Release( &r );
+
+  return copy;
+}
+
+/** Function  oyImage_ClearDirty
+ *  @memberof oyImage_s
+ *  @brief    Mark all pixels as up to date
+ *
+ *  @param[in,out] image               the image
+ *  @return                            0 on success, else error
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/16
+ *  @since   2026/10/16 (Oyranos: 0.9.7)
+ */
+int            oyImage_ClearDirty    ( oyImage_s         * image )
+{
+  oyImage_s_ * s = (oyImage_s_*)image;
+
+  if(!s)
+    return 1;
+
+  oyCheckType__m( oyOBJECT_IMAGE_S, return 1 )
+
+  return oyStructList_Release( &s->dirty_ );
+}
+
 /**
  *  Function oyImage_WritePPM
  *  @memberof oyImage_s
@@ -257,6 +257,23 @@ oyImage_s *    oyImage_Create        ( int                 width,
                                        oyPixel_t           pixel_layout,
                                        oyProfile_s       * profile,
                                        oyObject_s          object);
+oyImage_s *    oyImage_CreateFromStride (
+                                       int                 width,
+                                       int                 height,
+                                       oyPointer           pixels,
+                                       int                 stride,
+                                       int                 own_pixels,
+                                       oyPixel_t           pixel_layout,
+                                       oyProfile_s       * profile,
+                                       oyObject_s          object );
+oyImage_s *    oyImage_CreateFromLines(int                 width,
+                                       int                 height,
+                                       oyPixel_t           pixel_layout,
+                                       oyProfile_s       * profile,
+                                       oyStruct_s       ** pixel_data,
+                                       oyImage_GetLine_f   getLine,
+                                       oyImage_SetLine_f   setLine,
+                                       oyObject_s          object );
 oyImage_s *    oyImage_CreateForDisplay ( int              width,
                                        int                 height, 
                                        oyPointer           channels,
@@ -299,6 +316,12 @@ int            oyImage_ReadArray     ( oyImage_s         * image,
                                        oyRectangle_s     * rectangle,
                                        oyArray2d_s       * array,
                                        oyRectangle_s     * array_rectangle );
+int            oyImage_AddDirty      ( oyImage_s         * image,
+                                       oyRectangle_s     * pixels );
+int            oyImage_CountDirty    ( oyImage_s         * image );
+oyRectangle_s* oyImage_GetDirty      ( oyImage_s         * image,
+                                       int                 pos );
+int            oyImage_ClearDirty    ( oyImage_s         * image );
 int            oyImage_RoiToSamples  ( oyImage_s         * image,
                                        oyRectangle_s     * roi,
                                        oyRectangle_s    ** sample_rectangle );
@@ -36,11 +36,14 @@ typedef struct oyImage_s_ oyImage_s_;
 #include "oyranos_image.h"
 #include "oyRectangle_s.h"
 #include "oyProfile_s.h"
+#include "oyStructList_s.h"
   
 
 #include "oyImage_s.h"
 
 /* Include "Image.private.h" { */
+/** dirty rectangles before oyImage_AddDirty() merges all into one */
+#define OY_IMAGE_DIRTY_MAX 16
 
 /* } Include "Image.private.h" */
 
@@ -89,6 +92,7 @@ oyObject_s           oy_;            /**< Features name and hash. Do not change
   uint16_t             subsampling[2]; /**< 1, 2 or 4 */
   int                  sub_positioning;/**< 0 None, 1 Postscript, 2 CCIR 601-1*/
   oyStruct_s         * user_data;      /**< user provided pointer */
+  oyStructList_s     * dirty_;         /**< @private changed pixel rectangles, see oyImage_AddDirty() */
 
 /* } Include "Image.members.h" */
 
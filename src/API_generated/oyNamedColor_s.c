@@ -24,6 +24,8 @@
 #include "oyranos_object_internal.h"
 
 #include "oyNamedColor_s_.h"
+
+#include "oyranos_module_internal.h"
   
 
 
@@ -267,14 +269,13 @@ void   oyNamedColor_SetChannels      ( oyNamedColor_s    * color,
  *  @memberof oyNamedColor_s
  *  @brief   convert colors
  *
- *  The options are passed to oyConversion_CreateBasicPixels();
- *  The function does the lookups for the profiles and the modules contexts
- *  in the Oyranos cache on the fly. The allocated oyImage_s and
- *  oyConversion_s structures are not cheap as they are not cached.
+ *  The options are passed to oyConversion_CreateColors();
+ *  The prepared conversion is kept in the Oyranos cache for the profiles,
+ *  pixel types and options. Repeated calls run only the prepared graph.
  *
- *  @version Oyranos: 0.1.11
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/16
  *  @since   2007/12/23 (Oyranos: 0.1.8)
- *  @date    2010/09/10
  */
 int  oyColorConvert_  ( oyProfile_s       * p_in,
                         oyProfile_s       * p_out,
@@ -285,30 +286,54 @@ int  oyColorConvert_  ( oyProfile_s       * p_in,
                         oyOptions_s       * options,
                         int                 count )
 {
-  oyImage_s * in  = NULL,
-            * out = NULL;
   oyConversion_s * conv = NULL;
+  oyHash_s * entry = NULL;
+  char * hash_text = NULL;
+  uint32_t md5_in[4] = {0,0,0,0},
+           md5_out[4] = {0,0,0,0};
   int error = 0;
 
-  in    = oyImage_Create( count, 1,
-                         buf_in ,
-                         oyChannels_m(oyProfile_GetChannelsCount(p_in)) |
-                          oyDataType_m(buf_type_in),
-                         p_in,
-                         0 );
-  out   = oyImage_Create( count, 1,
-                         buf_out ,
-                         oyChannels_m(oyProfile_GetChannelsCount(p_out)) |
-                          oyDataType_m(buf_type_out),
-                         p_out,
-                         0 );
-
-  conv   = oyConversion_CreateBasicPixels( in,out, options, 0 );
-  error  = oyConversion_RunPixels( conv, 0 );
+  error = oyProfile_GetMD5( p_in, 0, md5_in );
+  if(error <= 0)
+    error = oyProfile_GetMD5( p_out, 0, md5_out );
+
+  if(error <= 0)
+  {
+    oyStringAddPrintf( &hash_text, oyAllocateFunc_, oyDeAllocateFunc_,
+                       "oyColorConvert_:%08x%08x%08x%08x->%08x%08x%08x%08x"
+                       " %d->%d %s",
+                       md5_in[0], md5_in[1], md5_in[2], md5_in[3],
+                       md5_out[0], md5_out[1], md5_out[2], md5_out[3],
+                       buf_type_in, buf_type_out,
+                       oyNoEmptyString_m_(
+                                 oyOptions_GetText( options, oyNAME_NICK ) ) );
+    entry = oyCMMCacheListGetEntry_( hash_text );
+    oyFree_m_( hash_text );
+    conv = (oyConversion_s*) oyHash_GetPointer( entry,
+                                                oyOBJECT_CONVERSION_S );
+    conv = oyConversion_Copy( conv, 0 );
+  }
+
+  if(!conv)
+  {
+    conv = oyConversion_CreateColors( p_in, oyDataType_m(buf_type_in),
+                                      p_out, oyDataType_m(buf_type_out),
+                                      options, 0 );
+    if(entry && conv)
+      oyHash_SetPointer( entry, (oyStruct_s*) conv );
+  }
+
+  if(conv)
+  {
+    /* the prepared conversion is shared through the cache */
+    oyObject_Lock( conv->oy_, __FILE__, __LINE__ );
+    error = oyConversion_RunColors( conv, buf_in, buf_out, count );
+    oyObject_UnLock( conv->oy_, __FILE__, __LINE__ );
+  } else
+    error = 1;
 
   oyConversion_Release( &conv );
-  oyImage_Release( &in );
-  oyImage_Release( &out );
+  oyHash_Release( &entry );
 
   return error;
 }
@@ -29,6 +29,7 @@
 #include "oyNamedColors_s_.h"
 
 #include "oyNamedColor_s_.h"
+#include "oyranos_alpha_internal.h"
   
 
 
@@ -438,5 +439,138 @@ const char * oyNamedColors_GetColorName (
   return text;
 }
 
+/** @memberof oyNamedColors_s
+ *  @brief    convert all colors at once
+ *
+ *  The colors are converted in one batch per color space instead of one
+ *  graph run per color. Colors without a XYZ value get it filled from
+ *  their channels, grouped by their profile. The XYZ values are then
+ *  converted together into the target profile. CIE*Lab is derived from
+ *  the XYZ values as in oyNamedColor_GetColorStd().
+ *
+ *  @param[in,out] colors              Oyranos colors struct pointer
+ *  @param[in]     profile             the target color space; optional,
+ *                                     without only the XYZ values are filled
+ *  @param[out]    buf                 packed output with all colors in
+ *                                     list order and profile channels;
+ *                                     optional like profile
+ *  @param[in]     buf_type            data type of buf
+ *  @param[in]     flags               for oyProfile_FromStd()
+ *  @param[in]     options             for oyConversion_CreateColors()
+ *  @return                            error
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/17
+ *  @since   2026/10/17 (Oyranos: 0.9.7)
+ */
+int    oyNamedColors_Convert         ( oyNamedColors_s   * colors,
+                                       oyProfile_s       * profile,
+                                       oyPointer           buf,
+                                       oyDATATYPE_e        buf_type,
+                                       uint32_t            flags,
+                                       oyOptions_s       * options )
+{
+  oyNamedColors_s_ * s = (oyNamedColors_s_*) colors;
+  oyNamedColor_s_ ** c = NULL;
+  oyProfile_s * p_xyz = NULL;
+  double * xyz = NULL,
+         * chan = NULL;
+  int * group = NULL;
+  int i, j, k, n, error = 0;
+
+  if(!colors)
+    return 1;
+
+  oyCheckType__m( oyOBJECT_NAMED_COLORS_S, return 1 )
+
+  n = oyStructList_Count( s->list_ );
+  if(!n)
+    return -1;
+
+  p_xyz = oyProfile_FromStd( oyEDITING_XYZ, flags, NULL );
+  if(!p_xyz)
+    return 1;
+
+  oyAllocHelper_m_( c, oyNamedColor_s_*, n, 0, error = 1; goto clean );
+  oyAllocHelper_m_( xyz, double, n * 3, 0, error = 1; goto clean );
+  oyAllocHelper_m_( group, int, n, 0, error = 1; goto clean );
+
+  /* take the cached XYZ values */
+  for(i = 0; i < n; ++i)
+  {
+    c[i] = (oyNamedColor_s_*) oyStructList_GetRefType( s->list_, i,
+                                                  oyOBJECT_NAMED_COLOR_S );
+    if(c[i] &&
+       c[i]->XYZ_[0] != -1 && c[i]->XYZ_[1] != -1 && c[i]->XYZ_[2] != -1)
+    {
+      oyCopyColor( c[i]->XYZ_, &xyz[i*3], 1, 0, 0 );
+      group[i] = -1;
+    } else
+      group[i] = 0;
+  }
+
+  /* fill the missing XYZ values, one conversion per color space */
+  for(i = 0; i < n && error <= 0; ++i)
+  {
+    oyProfile_s * p_in;
+    int m = 0, channels;
+
+    if(group[i] != 0)
+      continue;
+
+    if(!c[i] || !c[i]->channels_ || !c[i]->profile_)
+    {
+      error = 1;
+      break;
+    }
+
+    p_in = c[i]->profile_;
+    for(j = i; j < n; ++j)
+      if(group[j] == 0 && c[j] && c[j]->channels_ &&
+         (c[j]->profile_ == p_in || oyProfile_Equal( c[j]->profile_, p_in )))
+        group[j] = i + 1;
+
+    channels = oyProfile_GetChannelsCount( p_in );
+    for(j = i; j < n; ++j)
+      if(group[j] == i + 1)
+        ++m;
+
+    oyAllocHelper_m_( chan, double, (size_t)m * (channels + 3), 0,
+                      error = 1; break );
+    for(j = i, k = 0; j < n; ++j)
+      if(group[j] == i + 1)
+        memcpy( &chan[k++ * channels], c[j]->channels_,
+                sizeof(double) * channels );
+
+    error = oyColorConvert_( p_in, p_xyz, chan, &chan[m * channels],
+                             oyDOUBLE, oyDOUBLE, options, m );
+
+    if(error <= 0)
+      for(j = i, k = 0; j < n; ++j)
+        if(group[j] == i + 1)
+        {
+          oyCopyColor( &chan[m * channels + k++ * 3], c[j]->XYZ_, 1, 0, 0 );
+          oyCopyColor( c[j]->XYZ_, &xyz[j*3], 1, 0, 0 );
+        }
+    oyFree_m_( chan );
+  }
+
+  /* convert all colors together */
+  if(error <= 0 && profile && buf)
+    error = oyColorConvert_( p_xyz, profile, xyz, buf,
+                             oyDOUBLE, buf_type, options, n );
+
+clean:
+  if(c)
+    for(i = 0; i < n; ++i)
+      oyNamedColor_Release( (oyNamedColor_s**)&c[i] );
+  if(c) oyDeAllocateFunc_( c );
+  if(xyz) oyDeAllocateFunc_( xyz );
+  if(group) oyDeAllocateFunc_( group );
+  oyProfile_Release( &p_xyz );
+
+  return error;
+}
+
 /* } Include "NamedColors.public_methods_definitions.c" */
 
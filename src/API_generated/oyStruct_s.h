@@ -47,6 +47,7 @@ extern oyStruct_LockCreate_f   oyStruct_LockCreateFunc_;
 extern oyLockRelease_f         oyLockReleaseFunc_;
 extern oyLock_f                oyLockFunc_;
 extern oyUnLock_f              oyUnLockFunc_;
+extern oyPointer               oy_struct_global_lock_;
 /* } Locking function declarations */
 
 void         oyThreadLockingSet      ( oyStruct_LockCreate_f  createLockFunc,
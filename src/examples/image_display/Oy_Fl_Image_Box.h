@@ -41,6 +41,8 @@ public:
 
     oyFilterNode_s * icc = setImageType( image, display_image, data_type,
                                          cc_options );
+    /* the file pixels stay the same, so scrolling back needs no transform */
+    oyConversion_SetTileCache( conversion(), 64 * 1024 * 1024 );
     oyImage_Release( &image );
     oyImage_Release( &display_image );
 
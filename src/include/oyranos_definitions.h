@@ -394,6 +394,14 @@
  *  @since 0.9.6
  */
 #define OY_PROFILES_EFFECT                   OY_PROFILE_STD OY_SLASH "profiles_effect"
+/** key name for intermediate profiles in a filter node; set when a chain of
+ *  ICC nodes is merged into one node
+ *
+ *  type oyProfiles_s containing the colour spaces passed in between
+ *
+ *  @since 0.9.7
+ */
+#define OY_PROFILES_INTERMEDIATE             OY_PROFILE_STD OY_SLASH "profiles_intermediate"
 
 
 #endif /* OYRANOS_DEFINITIONS_H */
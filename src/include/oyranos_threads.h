@@ -100,6 +100,16 @@ extern oyThreadId_f oyThreadId;
 void               oyThreadIdSet     ( oyThreadId_f        tid,
                                        const char        * nick );
 
+int                oyTraceStart      ( const char        * file_name );
+int                oyTraceStop       ( void );
+double             oyTraceBegin      ( void );
+void               oyTraceEnd        ( double              start,
+                                       const char        * name,
+                                       const char        * category,
+                                       int                 thread_id );
+/** trace thread ID of a OpenMP worker thread, see oyTraceEnd() */
+#define oyTRACE_OMP_THREAD_ID(omp_thread_num) (1000 + (omp_thread_num))
+
 
 #ifdef __cplusplus
 } /* extern "C" */
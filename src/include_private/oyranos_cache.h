@@ -30,6 +30,14 @@ extern oyConfigs_s     * oy_monitors_cache_;
 extern oyProfiles_s    * oy_profile_list_cache_;
 extern oyProfile_s_   ** oy_profile_s_std_cache_;
 extern oyOptions_s     * oy_db_cache_;
+extern oyStructList_s  * oy_create_profile_cache_;
+extern oyPointer    (*oyProfile_ToMemForCache_p) (
+                                       oyStruct_s        * profile,
+                                       size_t            * size,
+                                       oyAlloc_f           allocateFunc );
+extern oyStruct_s * (*oyProfile_FromMemForCache_p) (
+                                       size_t              size,
+                                       const oyPointer     mem );
 
 int      oyObjectUsedByCache_        ( int                 id );
 int *    get_oy_db_cache_init_();
@@ -52,6 +52,7 @@ extern "C" {
 
 #define OY_WEB_RGB "sRGB.icc"
 #define OY_COLOR_DL_CACHE_PATH "openicc/device_link"
+#define OY_COLOR_PROFILE_CACHE_PATH "openicc/create_profile"
 #define OY_PIXMAPSDIRNAME "pixmaps"
 
 #if defined(__APPLE__)
@@ -68,6 +69,7 @@ extern "C" {
 # define CSNetworkPath                 "/Network/Library"  OS_ICC_PATH
 
 # define OS_CACHE_PATH       "/Caches/org.freedesktop." OY_COLOR_DL_CACHE_PATH
+# define OS_PROFILE_CACHE_PATH "/Caches/org.freedesktop." OY_COLOR_PROFILE_CACHE_PATH
 # define OS_LOGO_PATH     "/org.freedesktop.openicc/" OY_PIXMAPSDIRNAME
 # define OS_SETTING_PATH     "/Preferences/org.freedesktop.openicc/" OY_SETTINGSDIRNAME
 # define OS_SETTINGS_USER_DIR          OS_USER_DIR           OS_SETTING_PATH
@@ -89,6 +91,7 @@ extern "C" {
 # define OS_ICC_MACHINE_DIR            OS_MACHINE_DIR "lib/" OS_ICC_PATH
 
 # define OS_CACHE_PATH       "cache/color/" OY_COLOR_DL_CACHE_PATH
+# define OS_PROFILE_CACHE_PATH "cache/color/" OY_COLOR_PROFILE_CACHE_PATH
 # define OS_LOGO_PATH        OY_PIXMAPSDIRNAME
 # define OS_SETTING_PATH     "color/" OY_SETTINGSDIRNAME
 # define OS_SETTINGS_USER_DIR          OS_USER_DIR "config/" OS_SETTING_PATH
@@ -103,6 +106,7 @@ extern "C" {
 # define OS_DL_CACHE_USER_DIR          OS_USER_DIR           OS_CACHE_PATH
 # define OS_DL_CACHE_SYSTEM_DIR        OS_MACHINE_DIR        OS_CACHE_PATH
 # define OS_DL_CACHE_MACHINE_DIR       OS_MACHINE_DIR        OS_CACHE_PATH
+# define OS_PROFILE_CACHE_USER_DIR     OS_USER_DIR           OS_PROFILE_CACHE_PATH
 
 
 extern int oy_warn_;
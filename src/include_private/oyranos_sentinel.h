@@ -43,6 +43,9 @@ int   oyExportEnd_          (void);
 #define FINISH_IGNORE_I18N 0x01
 #define FINISH_IGNORE_CACHES 0x02
 void  oyFinish_             (int flags);
+/** @brief release global state of a higher level library in oyFinish_() */
+typedef void (*oyFinish_f)          (void);
+int   oyFinishAdd_          (oyFinish_f release);
 
 #ifdef __cplusplus
 } /* extern "C" */
@@ -69,7 +69,8 @@ int      oyAddLinearDisplayEffect    ( oyOptions_s      ** module_options )
 /** @brief  create_profile.white_point_adjust.bradford
  *
  *  The profile will be generated in many different shades, which will explode
- *  conversion cache.
+ *  conversion cache. The generated profiles are kept by the create_profile
+ *  cache of oyOptions_Handle().
  */
 int      oyProfileAddWhitePointEffect( oyProfile_s       * monitor_profile,
                                        oyOptions_s      ** module_options )
@@ -115,44 +116,13 @@ int      oyProfileAddWhitePointEffect( oyProfile_s       * monitor_profile,
   error = oyOptions_SetFromDouble( &opts, "//" OY_TYPE_STD "/illu_iccXYZ", dst_XYZ[0], 0, OY_CREATE_NEW );
   error = oyOptions_SetFromDouble( &opts, "//" OY_TYPE_STD "/illu_iccXYZ", dst_XYZ[1], 1, OY_CREATE_NEW );
   error = oyOptions_SetFromDouble( &opts, "//" OY_TYPE_STD "/illu_iccXYZ", dst_XYZ[2], 2, OY_CREATE_NEW );
-  /* cache the display white point abstract profile */
+  /* oyOptions_Handle() caches the display white point abstract profile */
   error = oyOptions_Handle( "//" OY_TYPE_STD "/create_profile.white_point_adjust.bradford",
-                            opts,             "create_profile.white_point_adjust.bradford.file_name",
-                            &result_opts );
-  DBG_S_( oyPrintTime() );
-  if(error == 0)
-  {
-    const char * file_name = oyOptions_FindString( result_opts, "file_name", 0 );
-    char * cache_path = oyGetInstallPath( oyPATH_CACHE, oySCOPE_USER, oyAllocateFunc_ ), *t;
-    if(strstr( cache_path, "device_link") != NULL)
-    {
-      t = strstr( cache_path, "device_link");
-      t[0] = '\000';
-      oyStringAddPrintf( &cache_path, 0,0, "white_point_adjust/%s.icc", file_name );
-    }
-
-    if(oyIsFile_(cache_path))
-    {
-      if(oy_debug)
-        oyMessageFunc_p( oyMSG_DBG,(oyStruct_s*)monitor_profile, OY_DBG_FORMAT_
-                     "found file_name: %s -> %s\n", OY_DBG_ARGS_, file_name, cache_path );
-      wtpt = oyProfile_FromFile( cache_path, 0,0 );
-      DBG_S_( oyPrintTime() );
-    } else
-    {
-      if(oy_debug)
-        oyMessageFunc_p( oyMSG_DBG,(oyStruct_s*)monitor_profile, OY_DBG_FORMAT_
-                     "creating file_name: %s -> %s\n", OY_DBG_ARGS_, file_name, cache_path );
-      error = oyOptions_Handle( "//" OY_TYPE_STD "/create_profile.white_point_adjust.bradford",
                             opts,             "create_profile.white_point_adjust.bradford",
                             &result_opts );
-      wtpt = (oyProfile_s*) oyOptions_GetType( result_opts, -1, "icc_profile",
+  wtpt = (oyProfile_s*) oyOptions_GetType( result_opts, -1, "icc_profile",
                                            oyOBJECT_PROFILE_S );
-      error = !wtpt;
-      oyProfile_ToFile_( (oyProfile_s_*) wtpt, cache_path );
-      DBG_S_( oyPrintTime() );
-    }
-  }
+  DBG_S_( oyPrintTime() );
 #else
   oyXYZ2Lab( src_XYZ, Lab );
   src_cie_a = Lab[1]/256.0+0.5;
@@ -86,6 +86,39 @@ int oyExportReset_(int export_check)
   return action;
 }
 
+#define OY_FINISH_MAX 8
+static oyFinish_f oy_finish_funcs_[OY_FINISH_MAX];
+static int oy_finish_funcs_n_ = 0;
+
+/** @internal
+ *  @brief    register a release function for oyFinish_()
+ *
+ *  Libraries above this one, like the imaging objects, and modules release
+ *  their caches with it. The functions run after the module caches are
+ *  released and before the modules are unloaded. A function is registered
+ *  only once. oyFinish_() empties the list; register again on next use.
+ *
+ *  @return                            0 - success, 1 - table full
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/17
+ *  @since   2026/10/17 (Oyranos: 0.9.7)
+ */
+int      oyFinishAdd_                ( oyFinish_f          release )
+{
+  int i;
+
+  for(i = 0; i < oy_finish_funcs_n_; ++i)
+    if(oy_finish_funcs_[i] == release)
+      return 0;
+
+  if(oy_finish_funcs_n_ >= OY_FINISH_MAX)
+    return 1;
+
+  oy_finish_funcs_[oy_finish_funcs_n_++] = release;
+  return 0;
+}
+
 /* @param          flags               - 0x01 keep i18n
  *                                     - 0x02 keep caches
  */
@@ -114,6 +147,14 @@ void     oyAlphaFinish_              ( int                 unused OY_UNUSED )
 {
   oyProfiles_Release( &oy_profile_list_cache_ );
   oyStructList_Release( &oy_cmm_cache_ );
+  oyStructList_Release( &oy_create_profile_cache_ );
+  {
+    int i;
+    for(i = 0; i < oy_finish_funcs_n_; ++i)
+      oy_finish_funcs_[i]();
+    /* module code might be unloaded below */
+    oy_finish_funcs_n_ = 0;
+  }
   oyStructList_Release( &oy_cmm_infos_ );
   oyStructList_Release( &oy_cmm_handles_ );
   oyStructList_Release_( &oy_profile_s_file_cache_ );
@@ -22,6 +22,17 @@
 #include "oyranos_debug.h"
 #include "oyranos_string.h"
 
+#include <stdio.h>
+#if defined(_WIN32) && !defined(__GNU__)
+# include <windows.h>
+#else
+# include <sys/time.h>
+# include <unistd.h>
+#endif
+#if defined(_OPENMP)
+# include <omp.h>
+#endif
+
 /** @addtogroup misc
  *
  *  @{ *//* misc */
@@ -296,6 +307,188 @@ void               oyThreadIdSet     ( oyThreadId_f        tid,
   oyThreadId = tid;
 }
 
+/** @internal
+ *  trace-event file of oyTraceStart() */
+static FILE * oy_trace_fp_ = NULL;
+static double oy_trace_start_ = 0.0;
+static int    oy_trace_pid_ = 0;
+
+/* micro seconds; oySeconds() is too coarse for short spans */
+static double      oyTraceMicroSeconds_ ( void )
+{
+#if defined(_WIN32) && !defined(__GNU__)
+  LARGE_INTEGER f, c;
+  QueryPerformanceFrequency( &f );
+  QueryPerformanceCounter( &c );
+  return (double)c.QuadPart * 1000000.0 / (double)f.QuadPart;
+#else
+  struct timeval tv;
+  gettimeofday( &tv, NULL );
+  return (double)tv.tv_sec * 1000000.0 + (double)tv.tv_usec;
+#endif
+}
+
+/* copy text into a JSON string without quotes and controls */
+static void        oyTraceEscape_    ( const char        * text,
+                                       char              * buf,
+                                       int                 size )
+{
+  int i = 0;
+  while(text && *text && i < size - 2)
+  {
+    if(*text == '"' || *text == '\\')
+      buf[i++] = '\\';
+    if((unsigned char)*text >= ' ')
+      buf[i++] = *text;
+    ++text;
+  }
+  buf[i] = '\000';
+}
+
+/**
+ *  @brief   Start writing a trace-event file
+ *
+ *  The file is written in the Chrome trace-event JSON format and can be
+ *  loaded into chrome://tracing or https://ui.perfetto.dev . Oyranos adds
+ *  spans for each oyFilterNode_Run(), for each context build inside
+ *  oyFilterGraph_PrepareContexts() and for oyImage_FillArray() and
+ *  oyImage_ReadArray(). Modules can add own spans with oyTraceBegin() and
+ *  oyTraceEnd().
+ *
+ *  Call oyTraceStart() and oyTraceStop() from the managing thread, while no
+ *  conversion is processed.
+ *
+ *  @param[in]     file_name           the trace file to write
+ *  @return                            0 - success, 1 - error
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/16
+ *  @since   2026/10/16 (Oyranos: 0.9.7)
+ */
+int                oyTraceStart      ( const char        * file_name )
+{
+  FILE * fp;
+
+  if(!file_name || !file_name[0])
+    return 1;
+
+  oyTraceStop();
+
+  fp = fopen( file_name, "w" );
+  if(!fp)
+  {
+    oyMessageFunc_p( oyMSG_WARN, NULL, OY_DBG_FORMAT_
+                     " can not open trace file: %s", OY_DBG_ARGS_, file_name );
+    return 1;
+  }
+
+#if defined(_WIN32) && !defined(__GNU__)
+  oy_trace_pid_ = (int)GetCurrentProcessId();
+#else
+  oy_trace_pid_ = (int)getpid();
+#endif
+  oy_trace_start_ = oyTraceMicroSeconds_();
+  fprintf( fp, "[\n" );
+  oy_trace_fp_ = fp;
+
+  return 0;
+}
+
+/**
+ *  @brief   Finish and close the trace-event file
+ *
+ *  @return                            0 - success, -1 - no trace was started
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/16
+ *  @since   2026/10/16 (Oyranos: 0.9.7)
+ */
+int                oyTraceStop       ( void )
+{
+  FILE * fp = oy_trace_fp_;
+
+  if(!fp)
+    return -1;
+
+  oy_trace_fp_ = NULL;
+  fprintf( fp, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":0,"
+               "\"args\":{\"name\":\"Oyranos\"}}\n]\n", oy_trace_pid_ );
+  fclose( fp );
+
+  return 0;
+}
+
+/**
+ *  @brief   Get the start time of a trace span
+ *
+ *  @return                            start time for oyTraceEnd(),
+ *                                     or zero if no trace is running
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/16
+ *  @since   2026/10/16 (Oyranos: 0.9.7)
+ */
+double             oyTraceBegin      ( void )
+{
+  if(!oy_trace_fp_)
+    return 0.0;
+  return oyTraceMicroSeconds_();
+}
+
+/**
+ *  @brief   Write a trace span
+ *
+ *  A span is written as one complete event. The stdio locking keeps
+ *  events from different threads apart.
+ *
+ *  @code
+    double trace = oyTraceBegin();
+    // do work
+    if(trace)
+      oyTraceEnd( trace, "work", "my_module", -1 );
+    @endcode
+ *
+ *  @param[in]     start               the oyTraceBegin() result
+ *  @param[in]     name                the span name
+ *  @param[in]     category            the span category
+ *  @param[in]     thread_id           -1 for the calling thread: oyThreadId()
+ *                                     or inside OpenMP workers
+ *                                     oyTRACE_OMP_THREAD_ID()
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/16
+ *  @since   2026/10/16 (Oyranos: 0.9.7)
+ */
+void               oyTraceEnd        ( double              start,
+                                       const char        * name,
+                                       const char        * category,
+                                       int                 thread_id )
+{
+  FILE * fp = oy_trace_fp_;
+  char n[256], c[64];
+  double end;
+
+  if(!fp || !start)
+    return;
+
+  end = oyTraceMicroSeconds_();
+#if defined(_OPENMP)
+  /* OpenMP workers are unknown to oyThreadId(); use the outermost team */
+  if(thread_id < 0 && omp_get_level() > 0 &&
+     omp_get_ancestor_thread_num( 1 ) > 0)
+    thread_id = oyTRACE_OMP_THREAD_ID( omp_get_ancestor_thread_num( 1 ) );
+#endif
+  if(thread_id < 0)
+    thread_id = oyThreadId();
+  oyTraceEscape_( name, n, 256 );
+  oyTraceEscape_( category, c, 64 );
+
+  fprintf( fp, "{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%.1f,"
+               "\"dur\":%.1f,\"pid\":%d,\"tid\":%d},\n",
+           n, c[0] ? c : "oyranos", start - oy_trace_start_, end - start,
+           oy_trace_pid_, thread_id );
+}
+
 
 /** @typedef oyJobCallback_f
  *  @brief   Progress callback for parallel job processing
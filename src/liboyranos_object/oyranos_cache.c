@@ -129,6 +129,31 @@ oyOptions_s * oy_db_cache_ = NULL;
  *  @date  05.2018 (API 0.9.7)
  */
 oyConfigs_s * oy_monitors_cache_ = NULL;
+/** @internal
+ *  @brief internal create_profile results
+ *
+ *  oyHash_s entries with the oyOptions_Handle() results, most recently used
+ *  last. The key is the module registration, command and input options.
+ *
+ *  @since Oyranos: version 0.9.7
+ *  @date  2026/10/17 (API 0.9.7)
+ */
+oyStructList_s * oy_create_profile_cache_ = NULL;
+/** @internal
+ *  @brief profile serialisation for the create_profile disk cache
+ *
+ *  libOyranosConfig sets both with the first oyProfile_s object.
+ *
+ *  @since Oyranos: version 0.9.7
+ *  @date  2026/10/17 (API 0.9.7)
+ */
+oyPointer    (*oyProfile_ToMemForCache_p) (
+                                       oyStruct_s        * profile,
+                                       size_t            * size,
+                                       oyAlloc_f           allocateFunc ) = NULL;
+oyStruct_s * (*oyProfile_FromMemForCache_p) (
+                                       size_t              size,
+                                       const oyPointer     mem ) = NULL;
 
 
 int      oyObjectUsedByStructList_   ( int                 id,
@@ -175,6 +200,8 @@ int      oyObjectUsedByCache_        ( int                 id )
   }
   if(!found && oy_monitors_cache_)
     found = oyObjectUsedByStructList_( id, ((oyConfigs_s_*)oy_monitors_cache_)->list_ );
+  if(!found)
+    found = oyObjectUsedByStructList_( id, oy_create_profile_cache_ );
 
   if(found)
     return 1;
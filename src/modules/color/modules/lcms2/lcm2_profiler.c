@@ -144,6 +144,43 @@ int  lcm2samplerFloat                ( const cmsFloat32Number In[],
   return result;
 }
 
+/* same node positions as cmsStageSampleCLutFloat() */
+static cmsFloat32Number lcm2GridNode_( int i, int grid_size )
+{
+  return (cmsFloat32Number)(floor( i * 65535.0 / (grid_size - 1) + 0.5 ) / 65535.0);
+}
+
+/* Fill a grid_size^3 x 3 float table with lcm2samplerFloat(). The slices of
+ * the first channel are spread over threads. The last channel varies fastest
+ * like in lcms CLUTs. */
+static int   lcm2SampleGridFloat_    ( lcm2Cargo_s       * cargo,
+                                       int                 grid_size,
+                                       cmsFloat32Number  * table )
+{
+  int i, fails = 0,
+      slice = grid_size * grid_size;
+
+#pragma omp parallel for reduction(+:fails)
+  for(i = 0; i < grid_size; ++i)
+  {
+    cmsFloat32Number in[max_channels], out[max_channels];
+    int j, k;
+
+    in[0] = lcm2GridNode_( i, grid_size );
+    for(j = 0; j < slice; ++j)
+    {
+      in[1] = lcm2GridNode_( j / grid_size, grid_size );
+      in[2] = lcm2GridNode_( j % grid_size, grid_size );
+      if(!lcm2samplerFloat( in, out, cargo ))
+        ++fails;
+      for(k = 0; k < 3; ++k)
+        table[(i * slice + j) * 3 + k] = out[k];
+    }
+  }
+
+  return fails;
+}
+
 /** \addtogroup profiler ICC profiler API
  *  @brief   Easy to use API to generate matrix and LUT ICC profiles.
  *
@@ -1127,6 +1164,10 @@ int          lcm2CreateProfileLutByFunc (
  *
  *  For some already available sampler funtions see @ref samplers.
  *
+ *  The grid is sampled in parallel threads, when compiled with OpenMP.
+ *  samplerMySpace is therefore called concurrently and shall not modify
+ *  samplerArg.
+ *
  *  @param[in,out] profile             profile to add LUT table
  *  @param[in]     samplerMySpace      the function to fill the LUT with color
  *  @param[in]     samplerArg          data pointer to samplerMySpace
@@ -1143,9 +1184,11 @@ int          lcm2CreateProfileLutByFunc (
  *                                     lcm2OpenProfileFile()
  *  @param[in]     grid_size           dimensions of the created LUT; e.g. 33
  *  @param[in]     tag_sig             tag signature for the generated LUT;
+ *  @return                            0 - success; 1 - error, e.g. a failed
+ *                                     sampler; profile stays untouched
  *
- *  @version Oyranos: 0.9.6
- *  @date    2017/05/17
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/17
  *  @since   2009/11/04 (Oyranos: 0.1.10)
  */
 int          lcm2CreateProfileLutByFuncAndCurves (
@@ -1170,12 +1213,14 @@ int          lcm2CreateProfileLutByFuncAndCurves (
               * gmt_pl16 = cmsPipelineAlloc( 0,3,3 );
  
   lcm2Cargo_s cargo;
-  int i;
+  cmsFloat32Number * table = NULL;
+  cmsUInt16Number * table16 = NULL;
+  int i, n;
   int error = 0;
   int in_layout, my_layout, out_layout;
   in_layout = my_layout = out_layout = (FLOAT_SH(1)|CHANNELS_SH(3)|BYTES_SH(0));
 
-  if(!profile) return 1;
+  if(!profile || grid_size < 2) return 1;
 
   if(in_space_profile) h_in_space  = lcm2OpenProfileFile( in_space_profile, NULL );
   if(my_space_profile) h_my_space  = lcm2OpenProfileFile( my_space_profile, NULL );
@@ -1210,21 +1255,29 @@ int          lcm2CreateProfileLutByFuncAndCurves (
   cargo.channelsProcess = h_my_space ? cmsChannelsOf( cmsGetColorSpace( h_my_space ) ) : 3;
   cargo.channelsOut = h_out_space ? cmsChannelsOf( cmsGetColorSpace( h_out_space ) ) : 3;
 
-#pragma omp parallel for
-  for(i = 0; i < 2; ++i)
-  {
-    if(i)
-    {
-      gmt_lut16 = cmsStageAllocCLut16bit( 0, grid_size, 3,3,0 );
-      cmsStageSampleCLut16bit( gmt_lut16, lcm2sampler16, &cargo, 0 );
+  /* sample once in parallel and derive both CLUTs from the table */
+  n = grid_size * grid_size * grid_size * 3;
+  table = (cmsFloat32Number*) malloc( n * sizeof(cmsFloat32Number) );
+  table16 = (cmsUInt16Number*) malloc( n * sizeof(cmsUInt16Number) );
+  if(!table || !table16) { lcm2msg_p( 300, NULL, "no memory for %d grid points", grid_size ); error = 1; goto lcm2CreateProfileLutByFuncAndCurvesClean; }
 
-    } else
-    {
-      gmt_lut = cmsStageAllocCLutFloat( 0, grid_size, 3,3,0 );
-      cmsStageSampleCLutFloat( gmt_lut, lcm2samplerFloat, &cargo, 0 );
-    }
+  i = lcm2SampleGridFloat_( &cargo, grid_size, table );
+  if(i) { lcm2msg_p( 300, NULL, "sampler failed for %d of %d grid points", i, n/3 ); error = 1; goto lcm2CreateProfileLutByFuncAndCurvesClean; }
+  for(i = 0; i < n; ++i)
+  {
+    double v = floor( table[i] * 65535.0 + 0.5 );
+    /* integer clipping; out of range values must not wrap */
+    if(v > 65535.0)
+      table16[i] = 65535;
+    else if(v > 0.0)
+      table16[i] = (cmsUInt16Number) v;
+    else
+      table16[i] = 0;
   }
 
+  gmt_lut16 = cmsStageAllocCLut16bit( 0, grid_size, 3,3, table16 );
+  gmt_lut = cmsStageAllocCLutFloat( 0, grid_size, 3,3, table );
+
 
   /* 16-bit int */
   cmsPipelineInsertStage( gmt_pl16, cmsAT_BEGIN,
@@ -1252,6 +1305,8 @@ lcm2CreateProfileLutByFuncAndCurvesClean:
   if(tr_MySpace2Out) {cmsDeleteTransform( tr_MySpace2Out );} tr_MySpace2Out = 0;
   if(gmt_pl16) cmsPipelineFree( gmt_pl16 );
   if(gmt_pl) cmsPipelineFree( gmt_pl );
+  lcm2Free_m( table );
+  lcm2Free_m( table16 );
 
   return error;
 }
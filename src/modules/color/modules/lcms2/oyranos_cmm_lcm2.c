@@ -39,7 +39,9 @@
 #include "oyranos_io.h"
 #include "oyranos_image.h"
 #include "oyranos_object_internal.h"
+#include "oyranos_sentinel.h"
 #include "oyranos_string.h"
+#include "oyranos_threads.h"
 
 #include "oyranos_cmm_lcm2.i18n.c"
 
@@ -48,6 +50,13 @@
 #include <omp.h>
 #endif
 
+/* target attributes and __builtin_cpu_supports() for the 3D LUT kernels */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__clang__) || __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))
+#define l2cmsLUT3D_X86 1
+#include <immintrin.h>
+#endif
+
 extern oyCMMapi4_s_   l2cms_api4_cmm;
 /*
 oyCMM_s               lcm2_cmm_module;
@@ -88,6 +97,9 @@ void  oyDeAllocateFunc_         (void *        data);
  *  marking, but at the prise of lost speed and increased memory consumption.
  *  53 is the grid size used internally in l2cms' gamut marking code. */
 #define l2cmsPROOF_LUT_GRID_RASTER 53
+/** The default white point LUTs grid size. The "grid_points" option of the
+ *  create_profile.white_point_adjust commands selects a other one. */
+#define l2cmsWHITE_POINT_LUT_GRID 15
 /*#define ENABLE_MPE 1*/
 
 #define CMM_VERSION {0,1,1}
@@ -131,6 +143,8 @@ typedef struct l2cmsTransformWrap_s_ {
   icColorSpaceSignature sig_out;       /**< ICC profile signature */
   oyPixel_t    oy_pixel_layout_in;
   oyPixel_t    oy_pixel_layout_out;
+  struct l2cmsLut3d_s_ * lut3d;        /**< optional native 8-bit RGB LUT */
+  struct l2cmsMatrixShaper_s_ * matrix_shaper; /**< optional RGB fast path */
 } l2cmsTransformWrap_s;
 
 
@@ -167,7 +181,8 @@ cmsHPROFILE  l2cmsGamutCheckAbstract ( oyProfile_s       * proof,
                                        cmsUInt32Number     flags,
                                        int                 intent,
                                        int                 intent_proof,
-                                       uint32_t            icc_profile_flags );
+                                       uint32_t            icc_profile_flags,
+                                       int                 batch );
 oyPointer  l2cmsCMMColorConversion_ToMem_ (
                                        cmsHTRANSFORM     * xform,
                                        oyOptions_s       * opts,
@@ -184,11 +199,15 @@ l2cmsProfileWrap_s * l2cmsAddProofProfile
                                        cmsUInt32Number     flags,
                                        int                 intent,
                                        int                 intent_proof,
-                                       uint32_t            icc_profile_flags );
+                                       uint32_t            icc_profile_flags,
+                                       int                 batch );
 oyPointer l2cmsFilterNode_CmmIccContextToMem (
                                        oyFilterNode_s    * node,
                                        size_t            * size,
                                        oyAlloc_f           allocateFunc );
+int      l2cmsFilterNode_GetProfilePair_ (
+                                       oyFilterNode_s    * node,
+                                       cmsHPROFILE       * pair );
 int  l2cmsModuleData_Convert         ( oyPointer_s       * data_in,
                                        oyPointer_s       * data_out,
                                        oyFilterNode_s    * node );
@@ -205,6 +224,12 @@ const char * l2cmsInfoGetText        ( const char        * select,
 /* explicitely load liblcms functions, to avoid conflicts */
 static int l2cms_initialised = 0; /* 0 - need init; 1 - successful init; -1 - error on init */
 static void * l2cms_handle = NULL;
+#if LCMS_VERSION >= 2060
+/* pool of lcms contexts shared by threads, see l2cmsThreadContext_() */
+#define l2cmsTHREAD_CONTEXTS_N 16
+static cmsContext l2cms_thread_contexts_[l2cmsTHREAD_CONTEXTS_N];
+static oyPointer l2cms_thread_contexts_lock_ = NULL;
+#endif
 
 static void (*l2cmsSetLogErrorHandler)(cmsLogErrorHandlerFunction Fn) = NULL;
 static void (*l2cmsSetLogErrorHandlerTHR)(     cmsContext ContextID,
@@ -290,6 +315,11 @@ static cmsToneCurve* (*l2cmsBuildGamma)(cmsContext ContextID, cmsFloat64Number G
 static cmsToneCurve*(*l2cmsBuildSegmentedToneCurve)(cmsContext ContextID, cmsInt32Number nSegments, const cmsCurveSegment Segments[]) = NULL;
 static cmsToneCurve*(*l2cmsBuildParametricToneCurve)(cmsContext ContextID, cmsInt32Number Type, const cmsFloat64Number Parameters[]) = NULL;
 static void (*l2cmsFreeToneCurve)(cmsToneCurve* Curve) = NULL;
+static cmsToneCurve* (*l2cmsReverseToneCurve)(const cmsToneCurve* InGamma) = NULL;
+static cmsFloat32Number (*l2cmsEvalToneCurveFloat)(const cmsToneCurve* Curve, cmsFloat32Number v) = NULL;
+static cmsBool (*l2cmsIsMatrixShaper)(cmsHPROFILE hProfile) = NULL;
+static cmsBool (*l2cmsIsCLUT)(cmsHPROFILE hProfile, cmsUInt32Number Intent, cmsUInt32Number UsedDirection) = NULL;
+static cmsUInt32Number (*l2cmsGetEncodedICCversion)(cmsHPROFILE hProfile) = NULL;
 static cmsHANDLE         (*l2cmsCIECAM02Init)               (cmsContext ContextID, const cmsViewingConditions* pVC) = NULL;
 static void              (*l2cmsCIECAM02Done)               (cmsHANDLE hModel) = NULL;
 static void              (*l2cmsCIECAM02Forward)            (cmsHANDLE hModel, const cmsCIEXYZ* pIn, cmsJCh* pOut) = NULL;
@@ -342,6 +372,8 @@ static cmsFloat64Number (*l2cmsDeltaE)(const cmsCIELab* Lab1, const cmsCIELab* L
 static void (*l2cmsGetAlarmCodes)(cmsUInt16Number NewAlarm[cmsMAXCHANNELS]) = NULL;
 static cmsContext (*l2cmsCreateContext)(void* Plugin, void* UserData) = NULL;
 static cmsContext dummyCreateContext(void* Plugin OY_UNUSED, void* UserData OY_UNUSED) {return NULL;}
+static void (*l2cmsDeleteContext)(cmsContext ContextID) = NULL;
+static void dummyDeleteContext(cmsContext ContextID OY_UNUSED) {;}
 static void* (*l2cmsGetContextUserData)(cmsContext ContextID) = NULL;
 static void* dummyGetContextUserData(cmsContext ContextID OY_UNUSED) {return NULL;}
 static cmsContext (*l2cmsGetProfileContextID)(cmsHPROFILE hProfile) = NULL;
@@ -458,6 +490,11 @@ int                l2cmsCMMInit       ( oyStruct_s        * filter OY_UNUSED )
       LOAD_FUNC( cmsBuildSegmentedToneCurve, NULL );
       LOAD_FUNC( cmsBuildParametricToneCurve, NULL );
       LOAD_FUNC( cmsFreeToneCurve, NULL );
+      LOAD_FUNC( cmsReverseToneCurve, NULL );
+      LOAD_FUNC( cmsEvalToneCurveFloat, NULL );
+      LOAD_FUNC( cmsIsMatrixShaper, NULL );
+      LOAD_FUNC( cmsIsCLUT, NULL );
+      LOAD_FUNC( cmsGetEncodedICCversion, NULL );
       LOAD_FUNC( cmsCIECAM02Init, NULL );
       LOAD_FUNC( cmsCIECAM02Done, NULL );
       LOAD_FUNC( cmsCIECAM02Forward, NULL );
@@ -500,9 +537,11 @@ int                l2cmsCMMInit       ( oyStruct_s        * filter OY_UNUSED )
       LOAD_FUNC( cmsGetAlarmCodes, NULL );
 #if LCMS_VERSION >= 2060
       LOAD_FUNC( cmsCreateContext, dummyCreateContext ); /* available since lcms 2.6 */
+      LOAD_FUNC( cmsDeleteContext, dummyDeleteContext ); /* available since lcms 2.6 */
       LOAD_FUNC( cmsGetContextUserData, dummyGetContextUserData ); /* available since lcms 2.6 */
 #else
       l2cmsCreateContext = dummyCreateContext;
+      l2cmsDeleteContext = dummyDeleteContext;
       l2cmsGetContextUserData = dummyGetContextUserData;
 #endif
       LOAD_FUNC( cmsGetProfileContextID, NULL );
@@ -540,6 +579,97 @@ int                l2cmsCMMInit       ( oyStruct_s        * filter OY_UNUSED )
   return error;
 }
 
+#if LCMS_VERSION >= 2060
+/* release the context pool; registered with oyFinishAdd_(), which runs
+ * before the modules are unloaded */
+static void  l2cmsThreadContextsRelease_( void )
+{
+  int i;
+
+  if(!l2cms_thread_contexts_lock_)
+    return;
+  oyLockFunc_( l2cms_thread_contexts_lock_, __func__, __LINE__ );
+  for(i = 0; i < l2cmsTHREAD_CONTEXTS_N; ++i)
+    if(l2cms_thread_contexts_[i])
+    {
+      l2cmsDeleteContext( l2cms_thread_contexts_[i] );
+      l2cms_thread_contexts_[i] = NULL;
+    }
+  oyUnLockFunc_( l2cms_thread_contexts_lock_, __func__, __LINE__ );
+}
+#endif
+
+/** Function l2cmsThreadContext_
+ *  @brief   get the lcms context of the calling thread
+ *
+ *  Transforms and their helper profiles are created inside a cmsContext
+ *  from a fixed pool. So threads preparing graphs in parallel do not all
+ *  go through the global lcms context. A thread selects its slot from
+ *  oyThreadId() and, inside OpenMP teams, from its team positions, as
+ *  OpenMP workers are unknown to the thread plug-in. Threads may share a
+ *  slot, as the contexts carry no user data. The pool does not grow with
+ *  the number of threads seen, as transforms keep their context until
+ *  they are released. The contexts are deleted by oyFinish_().
+ *  lcms before version 2.6 has no contexts and gets NULL, which selects
+ *  the global one.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/17
+ *  @since   2026/10/17 (Oyranos: 0.9.7)
+ */
+static cmsContext  l2cmsThreadContext_( void )
+{
+  cmsContext tc = NULL;
+#if LCMS_VERSION >= 2060
+  unsigned int slot;
+
+  if(l2cms_initialised != 1)
+    return tc;
+
+  slot = (unsigned int) oyThreadId();
+#if defined(_OPENMP)
+  {
+    int i, n = omp_get_level();
+    for(i = 1; i <= n; ++i)
+      slot = slot * 31 + (unsigned int) omp_get_ancestor_thread_num( i );
+  }
+#endif
+  slot %= l2cmsTHREAD_CONTEXTS_N;
+
+  if(!l2cms_thread_contexts_lock_)
+  {
+    oyLockFunc_( oy_struct_global_lock_, __func__, __LINE__ );
+    if(!l2cms_thread_contexts_lock_)
+      l2cms_thread_contexts_lock_ = oyStruct_LockCreateFunc_( NULL );
+    oyUnLockFunc_( oy_struct_global_lock_, __func__, __LINE__ );
+  }
+
+  tc = l2cms_thread_contexts_[slot];
+  if(tc)
+    return tc;
+
+  oyLockFunc_( l2cms_thread_contexts_lock_, __func__, __LINE__ );
+  tc = l2cms_thread_contexts_[slot];
+  if(!tc)
+  {
+    tc = l2cmsCreateContext( NULL, NULL );
+    if(tc)
+    {
+      l2cmsSetLogErrorHandlerTHR( tc, l2cmsErrorHandlerFunction );
+      l2cms_thread_contexts_[slot] = tc;
+      oyFinishAdd_( l2cmsThreadContextsRelease_ );
+      if(oy_debug >= 2)
+        l2cms_msg( oyMSG_DBG, NULL, OY_DBG_FORMAT_
+                   " slot: %u context: "OY_PRINT_POINTER,
+                   OY_DBG_ARGS_, slot, tc );
+    }
+  }
+  oyUnLockFunc_( l2cms_thread_contexts_lock_, __func__, __LINE__ );
+#endif
+
+  return tc;
+}
+
 #define cmsSetLogErrorHandler l2cmsSetLogErrorHandler
 #define cmsSetLogErrorHandlerTHR l2cmsSetLogErrorHandlerTHR
 #define cmsGetColorSpace l2cmsGetColorSpace
@@ -578,6 +708,11 @@ int                l2cmsCMMInit       ( oyStruct_s        * filter OY_UNUSED )
 #define cmsBuildSegmentedToneCurve l2cmsBuildSegmentedToneCurve
 #define cmsBuildParametricToneCurve l2cmsBuildParametricToneCurve
 #define cmsFreeToneCurve l2cmsFreeToneCurve
+#define cmsReverseToneCurve l2cmsReverseToneCurve
+#define cmsEvalToneCurveFloat l2cmsEvalToneCurveFloat
+#define cmsIsMatrixShaper l2cmsIsMatrixShaper
+#define cmsIsCLUT l2cmsIsCLUT
+#define cmsGetEncodedICCversion l2cmsGetEncodedICCversion
 #define cmsCIECAM02Init l2cmsCIECAM02Init
 #define cmsCIECAM02Done l2cmsCIECAM02Done
 #define cmsCIECAM02Forward l2cmsCIECAM02Forward
@@ -891,6 +1026,982 @@ int        oyPixelToLcm2PixelLayout_ ( oyPixel_t           pixel_layout,
   return cmm_pixel;
 }
 
+/* --- native 8-bit RGB 3D LUT --- */
+
+/** grid points per channel; 33 matches the lcms default for 8-bit RGB */
+#define l2cmsLUT3D_GRID 33
+
+typedef struct l2cmsLut3d_s_ l2cmsLut3d_s;
+typedef void (*l2cmsLut3dRun_f)      ( const l2cmsLut3d_s * lut,
+                                       const uint8_t     * in,
+                                       uint8_t           * out,
+                                       int                 n );
+/** @struct  l2cmsLut3d_s
+ *  @brief   baked 8-bit RGB(A) to 8-bit RGB(A) transform
+ *
+ *  The nodes are RGBx samples of the original cmsHTRANSFORM. The input
+ *  shaper tables map each 8-bit channel value to its grid cell and to the
+ *  position inside that cell, so the kernels need no division.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/16
+ *  @since   2026/10/16 (Oyranos: 0.9.7)
+ */
+struct l2cmsLut3d_s_ {
+  uint8_t    * nodes;                  /**< GRID^3 RGBx nodes, red slowest */
+  uint32_t     index[3][256];          /**< input shaper: cell byte offset */
+  uint32_t     weight[256];            /**< input shaper: 0 - 256 in cell */
+  int          channels_in;            /**< 3 or 4 */
+  int          channels_out;           /**< 3 or 4 */
+  l2cmsLut3dRun_f run;                 /**< selected kernel */
+  const char * kernel;                 /**< kernel name for debugging */
+};
+
+/* select the tetrahedron around pixel and its four weights summing to 256 */
+static void    l2cmsLut3dCell_       ( const l2cmsLut3d_s * lut,
+                                       const uint8_t     * pixel,
+                                       const uint8_t    ** c,
+                                       int               * w )
+{
+  const int X = l2cmsLUT3D_GRID * l2cmsLUT3D_GRID * 4,
+            Y = l2cmsLUT3D_GRID * 4,
+            Z = 4;
+  int rx = lut->weight[pixel[0]],
+      ry = lut->weight[pixel[1]],
+      rz = lut->weight[pixel[2]];
+  const uint8_t * c0 = lut->nodes + lut->index[0][pixel[0]] +
+                                    lut->index[1][pixel[1]] +
+                                    lut->index[2][pixel[2]];
+  int o1, o2;
+
+  if(rx >= ry)
+  {
+    if(ry >= rz)
+    { o1 = X; o2 = X+Y; w[0] = 256-rx; w[1] = rx-ry; w[2] = ry-rz; w[3] = rz;
+    } else if(rx >= rz)
+    { o1 = X; o2 = X+Z; w[0] = 256-rx; w[1] = rx-rz; w[2] = rz-ry; w[3] = ry;
+    } else
+    { o1 = Z; o2 = X+Z; w[0] = 256-rz; w[1] = rz-rx; w[2] = rx-ry; w[3] = ry;
+    }
+  } else
+  {
+    if(rz >= ry)
+    { o1 = Z; o2 = Y+Z; w[0] = 256-rz; w[1] = rz-ry; w[2] = ry-rx; w[3] = rx;
+    } else if(rz >= rx)
+    { o1 = Y; o2 = Y+Z; w[0] = 256-ry; w[1] = ry-rz; w[2] = rz-rx; w[3] = rx;
+    } else
+    { o1 = Y; o2 = X+Y; w[0] = 256-ry; w[1] = ry-rx; w[2] = rx-rz; w[3] = rz;
+    }
+  }
+
+  c[0] = c0;
+  c[1] = c0 + o1;
+  c[2] = c0 + o2;
+  c[3] = c0 + X+Y+Z;
+}
+
+/* portable kernel; the SIMD kernels compute bit identical results */
+static void    l2cmsLut3dRunC_       ( const l2cmsLut3d_s * lut,
+                                       const uint8_t     * in,
+                                       uint8_t           * out,
+                                       int                 n )
+{
+  const int ci = lut->channels_in,
+            co = lut->channels_out;
+  const uint8_t * c[4];
+  int w[4], i, j;
+
+  for(i = 0; i < n; ++i)
+  {
+    l2cmsLut3dCell_( lut, in, c, w );
+    /* extra channels are left untouched like l2cmsDoTransform() does */
+    for(j = 0; j < 3; ++j)
+      out[j] = (uint8_t)((c[0][j]*w[0] + c[1][j]*w[1] + c[2][j]*w[2] +
+                          c[3][j]*w[3] + 128) >> 8);
+    in += ci;
+    out += co;
+  }
+}
+
+#if defined(l2cmsLUT3D_X86)
+/* Four pixels per iteration with the AVX2 arithmetic below; SSE4.1 has no
+ * gather, so the table and node reads stay scalar. */
+__attribute__((target("sse4.1")))
+static void    l2cmsLut3dRunSSE41_   ( const l2cmsLut3d_s * lut,
+                                       const uint8_t     * in,
+                                       uint8_t           * out,
+                                       int                 n )
+{
+  const int ci = lut->channels_in,
+            co = lut->channels_out,
+            X = l2cmsLUT3D_GRID * l2cmsLUT3D_GRID * 4,
+            Y = l2cmsLUT3D_GRID * 4,
+            Z = 4;
+  const __m128i even = _mm_set1_epi32( 0x00ff00ff ),
+                odd = _mm_set1_epi32( 0x0000ff00 ),
+                round = _mm_set1_epi32( 0x00800080 ),
+                full = _mm_set1_epi32( 256 ),
+                all = _mm_set1_epi32( -1 ),
+                vX = _mm_set1_epi32( X ),
+                vY = _mm_set1_epi32( Y ),
+                vZ = _mm_set1_epi32( Z ),
+                vXYZ = _mm_set1_epi32( X+Y+Z );
+  const uint32_t * w = lut->weight;
+  const uint8_t * nodes = lut->nodes;
+  uint32_t base[4], o1[4], o2[4], nd[4][4], result[4];
+  int i = 0, j;
+
+  for(i = 0; i + 4 <= n; i += 4)
+  {
+    const uint8_t * p = in;
+    __m128i rx = _mm_setr_epi32( w[p[0]], w[p[ci]], w[p[2*ci]], w[p[3*ci]] ),
+            ry = _mm_setr_epi32( w[p[1]], w[p[ci+1]], w[p[2*ci+1]], w[p[3*ci+1]] ),
+            rz = _mm_setr_epi32( w[p[2]], w[p[ci+2]], w[p[2*ci+2]], w[p[3*ci+2]] ),
+            hi = _mm_max_epi32( rx, _mm_max_epi32( ry, rz ) ),
+            lo = _mm_min_epi32( rx, _mm_min_epi32( ry, rz ) ),
+            mid = _mm_sub_epi32( _mm_add_epi32( rx, _mm_add_epi32( ry, rz ) ),
+                                 _mm_add_epi32( hi, lo ) ),
+            x_first = _mm_andnot_si128( _mm_or_si128( _mm_cmpgt_epi32( ry, rx ),
+                                                      _mm_cmpgt_epi32( rz, rx ) ), all ),
+            y_first = _mm_andnot_si128( _mm_cmpgt_epi32( rz, ry ), all ),
+            z_last = _mm_andnot_si128( _mm_or_si128( _mm_cmpgt_epi32( rz, ry ),
+                                                     _mm_cmpgt_epi32( rz, rx ) ), all ),
+            y_last = _mm_andnot_si128( _mm_cmpgt_epi32( ry, rx ), all ),
+            w0 = _mm_sub_epi32( full, hi ),
+            w1 = _mm_sub_epi32( hi, mid ),
+            w2 = _mm_sub_epi32( mid, lo ),
+            w3 = lo,
+            n0, n1, n2, n3, rb, gx, pixel;
+
+    _mm_storeu_si128( (__m128i*)o1,
+                      _mm_blendv_epi8( _mm_blendv_epi8( vZ, vY, y_first ), vX, x_first ) );
+    _mm_storeu_si128( (__m128i*)o2,
+                      _mm_sub_epi32( vXYZ, _mm_blendv_epi8( _mm_blendv_epi8( vX, vY, y_last ),
+                                                             vZ, z_last ) ) );
+    for(j = 0; j < 4; ++j, p += ci)
+    {
+      base[j] = lut->index[0][p[0]] + lut->index[1][p[1]] + lut->index[2][p[2]];
+      memcpy( &nd[0][j], nodes + base[j], 4 );
+      memcpy( &nd[1][j], nodes + base[j] + o1[j], 4 );
+      memcpy( &nd[2][j], nodes + base[j] + o2[j], 4 );
+      memcpy( &nd[3][j], nodes + base[j] + X+Y+Z, 4 );
+    }
+    n0 = _mm_loadu_si128( (const __m128i*)nd[0] );
+    n1 = _mm_loadu_si128( (const __m128i*)nd[1] );
+    n2 = _mm_loadu_si128( (const __m128i*)nd[2] );
+    n3 = _mm_loadu_si128( (const __m128i*)nd[3] );
+
+    w0 = _mm_or_si128( w0, _mm_slli_epi32( w0, 16 ) );
+    w1 = _mm_or_si128( w1, _mm_slli_epi32( w1, 16 ) );
+    w2 = _mm_or_si128( w2, _mm_slli_epi32( w2, 16 ) );
+    w3 = _mm_or_si128( w3, _mm_slli_epi32( w3, 16 ) );
+
+    rb = _mm_add_epi16( round,
+         _mm_add_epi16(
+         _mm_add_epi16( _mm_mullo_epi16( _mm_and_si128( n0, even ), w0 ),
+                        _mm_mullo_epi16( _mm_and_si128( n1, even ), w1 ) ),
+         _mm_add_epi16( _mm_mullo_epi16( _mm_and_si128( n2, even ), w2 ),
+                        _mm_mullo_epi16( _mm_and_si128( n3, even ), w3 ) ) ) );
+    gx = _mm_add_epi16( round,
+         _mm_add_epi16(
+         _mm_add_epi16( _mm_mullo_epi16( _mm_and_si128( _mm_srli_epi32( n0, 8 ), even ), w0 ),
+                        _mm_mullo_epi16( _mm_and_si128( _mm_srli_epi32( n1, 8 ), even ), w1 ) ),
+         _mm_add_epi16( _mm_mullo_epi16( _mm_and_si128( _mm_srli_epi32( n2, 8 ), even ), w2 ),
+                        _mm_mullo_epi16( _mm_and_si128( _mm_srli_epi32( n3, 8 ), even ), w3 ) ) ) );
+    pixel = _mm_or_si128( _mm_and_si128( _mm_srli_epi16( rb, 8 ), even ),
+                          _mm_and_si128( gx, odd ) );
+    _mm_storeu_si128( (__m128i*)result, pixel );
+
+    for(j = 0; j < 4; ++j)
+      memcpy( out + j * co, &result[j], 3 );
+    in += 4 * ci;
+    out += 4 * co;
+  }
+
+  if(i < n)
+    l2cmsLut3dRunC_( lut, in, out, n - i );
+}
+
+/* Eight pixels per iteration. The shaper tables and nodes are gathered.
+ * The tetrahedron is found by sorting the three cell positions: the largest
+ * one names the first step, the smallest one the last step. Ties only occur
+ * together with zero weights, so the result equals l2cmsLut3dRunC_().
+ * Node bytes are split into 16-bit lanes, red/blue and green/x. */
+__attribute__((target("avx2")))
+static void    l2cmsLut3dRunAVX2_    ( const l2cmsLut3d_s * lut,
+                                       const uint8_t     * in,
+                                       uint8_t           * out,
+                                       int                 n )
+{
+  const int ci = lut->channels_in,
+            co = lut->channels_out,
+            X = l2cmsLUT3D_GRID * l2cmsLUT3D_GRID * 4,
+            Y = l2cmsLUT3D_GRID * 4,
+            Z = 4;
+  const __m256i vci = _mm256_setr_epi32( 0, ci, 2*ci, 3*ci,
+                                         4*ci, 5*ci, 6*ci, 7*ci ),
+                byte = _mm256_set1_epi32( 0xff ),
+                even = _mm256_set1_epi32( 0x00ff00ff ),
+                odd = _mm256_set1_epi32( 0x0000ff00 ),
+                color = _mm256_set1_epi32( 0x00ffffff ),
+                round = _mm256_set1_epi32( 0x00800080 ),
+                full = _mm256_set1_epi32( 256 ),
+                vX = _mm256_set1_epi32( X ),
+                vY = _mm256_set1_epi32( Y ),
+                vZ = _mm256_set1_epi32( Z ),
+                vXYZ = _mm256_set1_epi32( X+Y+Z );
+  const int * weight = (const int*) lut->weight,
+            * nodes = (const int*) lut->nodes;
+  uint32_t result[8];
+  int i = 0, j;
+
+  /* the 32-bit gather reads one byte past a 3 channel pixel */
+  for(i = 0; i + 8 < n || (ci == 4 && i + 8 <= n); i += 8)
+  {
+    __m256i pixel = _mm256_i32gather_epi32( (const int*)in, vci, 1 ),
+            r = _mm256_and_si256( pixel, byte ),
+            g = _mm256_and_si256( _mm256_srli_epi32( pixel, 8 ), byte ),
+            b = _mm256_and_si256( _mm256_srli_epi32( pixel, 16 ), byte ),
+            rx = _mm256_i32gather_epi32( weight, r, 4 ),
+            ry = _mm256_i32gather_epi32( weight, g, 4 ),
+            rz = _mm256_i32gather_epi32( weight, b, 4 ),
+            base = _mm256_add_epi32(
+                   _mm256_add_epi32( _mm256_i32gather_epi32( (const int*)lut->index[0], r, 4 ),
+                                     _mm256_i32gather_epi32( (const int*)lut->index[1], g, 4 ) ),
+                                     _mm256_i32gather_epi32( (const int*)lut->index[2], b, 4 ) ),
+            hi = _mm256_max_epi32( rx, _mm256_max_epi32( ry, rz ) ),
+            lo = _mm256_min_epi32( rx, _mm256_min_epi32( ry, rz ) ),
+            mid = _mm256_sub_epi32( _mm256_add_epi32( rx, _mm256_add_epi32( ry, rz ) ),
+                                    _mm256_add_epi32( hi, lo ) ),
+            /* first step: x if largest, else y if not below z, else z */
+            x_first = _mm256_andnot_si256( _mm256_or_si256( _mm256_cmpgt_epi32( ry, rx ),
+                                                            _mm256_cmpgt_epi32( rz, rx ) ),
+                                           _mm256_set1_epi32( -1 ) ),
+            y_first = _mm256_andnot_si256( _mm256_cmpgt_epi32( rz, ry ),
+                                           _mm256_set1_epi32( -1 ) ),
+            o1 = _mm256_blendv_epi8( _mm256_blendv_epi8( vZ, vY, y_first ),
+                                     vX, x_first ),
+            /* last step: z if smallest, else y if not above x, else x */
+            z_last = _mm256_andnot_si256( _mm256_or_si256( _mm256_cmpgt_epi32( rz, ry ),
+                                                           _mm256_cmpgt_epi32( rz, rx ) ),
+                                          _mm256_set1_epi32( -1 ) ),
+            y_last = _mm256_andnot_si256( _mm256_cmpgt_epi32( ry, rx ),
+                                          _mm256_set1_epi32( -1 ) ),
+            o2 = _mm256_sub_epi32( vXYZ,
+                                   _mm256_blendv_epi8( _mm256_blendv_epi8( vX, vY, y_last ),
+                                                       vZ, z_last ) ),
+            n0 = _mm256_i32gather_epi32( nodes, base, 1 ),
+            n1 = _mm256_i32gather_epi32( nodes, _mm256_add_epi32( base, o1 ), 1 ),
+            n2 = _mm256_i32gather_epi32( nodes, _mm256_add_epi32( base, o2 ), 1 ),
+            n3 = _mm256_i32gather_epi32( nodes, _mm256_add_epi32( base, vXYZ ), 1 ),
+            /* weights duplicated into both 16-bit halves */
+            w0 = _mm256_sub_epi32( full, hi ),
+            w1 = _mm256_sub_epi32( hi, mid ),
+            w2 = _mm256_sub_epi32( mid, lo ),
+            w3 = lo,
+            rb, gx;
+
+    w0 = _mm256_or_si256( w0, _mm256_slli_epi32( w0, 16 ) );
+    w1 = _mm256_or_si256( w1, _mm256_slli_epi32( w1, 16 ) );
+    w2 = _mm256_or_si256( w2, _mm256_slli_epi32( w2, 16 ) );
+    w3 = _mm256_or_si256( w3, _mm256_slli_epi32( w3, 16 ) );
+
+    rb = _mm256_add_epi16( round,
+         _mm256_add_epi16(
+         _mm256_add_epi16( _mm256_mullo_epi16( _mm256_and_si256( n0, even ), w0 ),
+                           _mm256_mullo_epi16( _mm256_and_si256( n1, even ), w1 ) ),
+         _mm256_add_epi16( _mm256_mullo_epi16( _mm256_and_si256( n2, even ), w2 ),
+                           _mm256_mullo_epi16( _mm256_and_si256( n3, even ), w3 ) ) ) );
+    gx = _mm256_add_epi16( round,
+         _mm256_add_epi16(
+         _mm256_add_epi16( _mm256_mullo_epi16( _mm256_and_si256( _mm256_srli_epi32( n0, 8 ), even ), w0 ),
+                           _mm256_mullo_epi16( _mm256_and_si256( _mm256_srli_epi32( n1, 8 ), even ), w1 ) ),
+         _mm256_add_epi16( _mm256_mullo_epi16( _mm256_and_si256( _mm256_srli_epi32( n2, 8 ), even ), w2 ),
+                           _mm256_mullo_epi16( _mm256_and_si256( _mm256_srli_epi32( n3, 8 ), even ), w3 ) ) ) );
+    pixel = _mm256_or_si256( _mm256_and_si256( _mm256_srli_epi16( rb, 8 ), even ),
+                             _mm256_and_si256( gx, odd ) );
+
+    if(co == 4)
+    {
+      /* keep the extra channel as l2cmsDoTransform() does */
+      __m256i dst = _mm256_loadu_si256( (const __m256i*)out );
+      _mm256_storeu_si256( (__m256i*)out,
+                           _mm256_blendv_epi8( dst, pixel, color ) );
+    } else
+    {
+      _mm256_storeu_si256( (__m256i*)result, pixel );
+      for(j = 0; j < 8; ++j)
+        memcpy( out + j * 3, &result[j], 3 );
+    }
+    in += 8 * ci;
+    out += 8 * co;
+  }
+
+  if(i < n)
+    l2cmsLut3dRunC_( lut, in, out, n - i );
+}
+#endif /* l2cmsLUT3D_X86 */
+
+/* runtime CPU dispatch */
+static l2cmsLut3dRun_f l2cmsLut3dKernel_( const char ** name )
+{
+#if defined(l2cmsLUT3D_X86)
+  __builtin_cpu_init();
+  if(__builtin_cpu_supports( "avx2" ))
+  {
+    *name = "avx2";
+    return l2cmsLut3dRunAVX2_;
+  }
+  if(__builtin_cpu_supports( "sse4.1" ))
+  {
+    *name = "sse4.1";
+    return l2cmsLut3dRunSSE41_;
+  }
+#endif
+  *name = "C";
+  return l2cmsLut3dRunC_;
+}
+
+/** Function l2cmsLut3dCanHandle_
+ *  @brief   check a pixel layout for the native 3D LUT
+ *
+ *  Only interleaved 8-bit RGB and RGBA in natural channel order qualifies.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/16
+ *  @since   2026/10/16 (Oyranos: 0.9.7)
+ */
+static int     l2cmsLut3dCanHandle_  ( oyPixel_t           pixel_layout,
+                                       icColorSpaceSignature color_space )
+{
+  int chan_n = oyToChannels_m( pixel_layout );
+
+  return color_space == icSigRgbData &&
+         oyToDataType_m( pixel_layout ) == oyUINT8 &&
+         (chan_n == 3 || chan_n == 4) &&
+         oyToColorOffset_m( pixel_layout ) == 0 &&
+         !oyToSwapColorChannels_m( pixel_layout ) &&
+         !oyToPlanar_m( pixel_layout ) &&
+         !oyToFlavor_m( pixel_layout );
+}
+
+/** Function l2cmsLut3dCreate_
+ *  @brief   bake a 8-bit RGB(A) transform into a 3D LUT
+ *
+ *  The grid nodes sit on exact 8-bit values, so a single l2cmsDoTransform()
+ *  call in the transforms own pixel layout samples all of them.
+ *
+ *  @param[in]     xform               a 8-bit RGB(A) to RGB(A) transform
+ *  @param[in]     oy_pixel_layout_in  the transforms input layout
+ *  @param[in]     oy_pixel_layout_out the transforms output layout
+ *  @return                            the LUT or NULL
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/16
+ *  @since   2026/10/16 (Oyranos: 0.9.7)
+ */
+static l2cmsLut3d_s * l2cmsLut3dCreate_ ( cmsHTRANSFORM       xform,
+                                       oyPixel_t           oy_pixel_layout_in,
+                                       oyPixel_t           oy_pixel_layout_out )
+{
+  const int g = l2cmsLUT3D_GRID,
+            nodes_n = l2cmsLUT3D_GRID * l2cmsLUT3D_GRID * l2cmsLUT3D_GRID;
+  int ci = oyToChannels_m( oy_pixel_layout_in ),
+      co = oyToChannels_m( oy_pixel_layout_out );
+  uint8_t pos[l2cmsLUT3D_GRID], * in, * out, * p;
+  l2cmsLut3d_s * lut;
+  int i, r, gr, b, v;
+
+  if(!xform)
+    return NULL;
+
+  in = malloc( nodes_n * ci );
+  out = calloc( nodes_n * co, 1 );
+  lut = calloc( sizeof(l2cmsLut3d_s), 1 );
+  if(lut)
+    lut->nodes = malloc( nodes_n * 4 );
+  if(!in || !out || !lut || !lut->nodes)
+  {
+    if(in) free( in );
+    if(out) free( out );
+    if(lut && lut->nodes) free( lut->nodes );
+    if(lut) free( lut );
+    return NULL;
+  }
+
+  for(i = 0; i < g; ++i)
+    pos[i] = (uint8_t)((i * 255 + (g-1)/2) / (g-1));
+
+  p = in;
+  for(r = 0; r < g; ++r)
+    for(gr = 0; gr < g; ++gr)
+      for(b = 0; b < g; ++b)
+      {
+        p[0] = pos[r]; p[1] = pos[gr]; p[2] = pos[b];
+        if(ci == 4) p[3] = 255;
+        p += ci;
+      }
+
+  l2cmsDoTransform( xform, in, out, nodes_n );
+
+  for(i = 0; i < nodes_n; ++i)
+  {
+    memcpy( &lut->nodes[i*4], &out[i*co], 3 );
+    lut->nodes[i*4+3] = 0;
+  }
+
+  /* input shaper; 255 falls into the last cell with full weight */
+  for(v = 0, i = 0; v < 256; ++v)
+  {
+    int width;
+    while(i < g-2 && v >= pos[i+1])
+      ++i;
+    width = pos[i+1] - pos[i];
+    lut->weight[v] = (uint32_t)(((v - pos[i]) * 256 + width/2) / width);
+    lut->index[0][v] = i * g * g * 4;
+    lut->index[1][v] = i * g * 4;
+    lut->index[2][v] = i * 4;
+  }
+
+  lut->channels_in = ci;
+  lut->channels_out = co;
+  lut->run = l2cmsLut3dKernel_( &lut->kernel );
+
+  free( in );
+  free( out );
+
+  if(oy_debug)
+    l2cms_msg( oyMSG_DBG, NULL, OY_DBG_FORMAT_
+               " native 3D LUT: %d^3 %d->%d channels kernel: %s",
+               OY_DBG_ARGS_, g, ci, co, lut->kernel );
+
+  return lut;
+}
+
+/** Function l2cmsLut3dRelease_
+ *  @brief   release a l2cmsLut3d_s
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/16
+ *  @since   2026/10/16 (Oyranos: 0.9.7)
+ */
+static void    l2cmsLut3dRelease_    ( l2cmsLut3d_s     ** lut )
+{
+  if(lut && *lut)
+  {
+    free( (*lut)->nodes );
+    free( *lut );
+    *lut = NULL;
+  }
+}
+
+/* --- matrix/shaper fast path --- */
+
+/** entries of the linearisation and encoding tables */
+#define l2cmsSHAPER_SIZE 4096
+/** pixels converted to planar floats at once */
+#define l2cmsSHAPER_CHUNK 256
+
+typedef struct l2cmsMatrixShaper_s_ l2cmsMatrixShaper_s;
+typedef void (*l2cmsMatrixShaperCore_f)( const l2cmsMatrixShaper_s * ms,
+                                       float             * r,
+                                       float             * g,
+                                       float             * b,
+                                       int                 n );
+/** @struct  l2cmsMatrixShaper_s
+ *  @brief   RGB curves, 3x3 matrix, RGB curves
+ *
+ *  The input tables are indexed by the encoded value. The output tables
+ *  are indexed by the square root of the linear value, which keeps the
+ *  steep start of gamma encodings accurate. Pixels with values outside
+ *  0-1 are left to lcms, as clipping and extrapolation depend on the
+ *  curve types there.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/17
+ *  @since   2026/10/17 (Oyranos: 0.9.7)
+ */
+struct l2cmsMatrixShaper_s_ {
+  float        in[3][l2cmsSHAPER_SIZE + 1];  /**< encoded -> linear */
+  float        out[3][l2cmsSHAPER_SIZE + 1]; /**< sqrt(linear) -> encoded */
+  float        matrix[3][3];           /**< linear input -> linear output */
+  oyDATATYPE_e type_in;
+  oyDATATYPE_e type_out;
+  int          channels_in;            /**< 3 or 4 */
+  int          channels_out;           /**< 3 or 4 */
+  l2cmsMatrixShaperCore_f core;        /**< selected kernel */
+  const char * kernel;                 /**< kernel name for debugging */
+};
+
+static float   l2cmsHalfToFloat_     ( uint16_t            h )
+{
+  uint32_t sign = (uint32_t)(h & 0x8000) << 16,
+           exp = (h >> 10) & 0x1f,
+           mant = h & 0x3ff,
+           f;
+  float v;
+
+  if(exp == 0)
+  {
+    v = ldexpf( (float)mant, -24 );
+    return sign ? -v : v;
+  }
+  if(exp == 31)
+    f = sign | 0x7f800000 | (mant << 13);
+  else
+    f = sign | ((exp + 112) << 23) | (mant << 13);
+  memcpy( &v, &f, 4 );
+  return v;
+}
+
+/* round to nearest even */
+static uint16_t l2cmsFloatToHalf_    ( float               v )
+{
+  uint32_t f, sign, mant, h, rem, half;
+  int exp;
+
+  memcpy( &f, &v, 4 );
+  sign = (f >> 16) & 0x8000;
+  mant = f & 0x7fffff;
+  if(((f >> 23) & 0xff) == 0xff)
+    return sign | 0x7c00 | (mant ? 0x200 : 0);
+  exp = (int)((f >> 23) & 0xff) - 127 + 15;
+  if(exp >= 31)
+    return sign | 0x7c00;
+  if(exp <= 0)
+  {
+    int shift = 14 - exp;
+    if(exp < -10)
+      return sign;
+    mant |= 0x800000;
+    h = mant >> shift;
+    rem = mant & ((1u << shift) - 1);
+    half = 1u << (shift - 1);
+    if(rem > half || (rem == half && (h & 1)))
+      ++h;
+    return sign | h;
+  }
+  h = ((uint32_t)exp << 10) | (mant >> 13);
+  rem = mant & 0x1fff;
+  if(rem > 0x1000 || (rem == 0x1000 && (h & 1)))
+    ++h;
+  return sign | h;
+}
+
+/* interleaved pixels -> planar floats */
+static void    l2cmsMatrixShaperLoad_( const l2cmsMatrixShaper_s * ms,
+                                       const uint8_t     * in,
+                                       float            ** rgb,
+                                       int                 n )
+{
+  const int ch = ms->channels_in;
+  int i, c;
+
+  switch(ms->type_in)
+  {
+  case oyUINT16:
+    for(c = 0; c < 3; ++c)
+      for(i = 0; i < n; ++i)
+        rgb[c][i] = ((const uint16_t*)in)[i*ch+c] * (1.0f/65535.0f);
+    break;
+  case oyHALF:
+    for(c = 0; c < 3; ++c)
+      for(i = 0; i < n; ++i)
+        rgb[c][i] = l2cmsHalfToFloat_( ((const uint16_t*)in)[i*ch+c] );
+    break;
+  case oyFLOAT:
+    for(c = 0; c < 3; ++c)
+      for(i = 0; i < n; ++i)
+        rgb[c][i] = ((const float*)in)[i*ch+c];
+    break;
+  case oyDOUBLE:
+    for(c = 0; c < 3; ++c)
+      for(i = 0; i < n; ++i)
+        rgb[c][i] = (float)((const double*)in)[i*ch+c];
+    break;
+  default: break;
+  }
+}
+
+/* planar floats -> interleaved pixels; extra channels stay untouched */
+static void    l2cmsMatrixShaperStore_(const l2cmsMatrixShaper_s * ms,
+                                       float            ** rgb,
+                                       uint8_t           * out,
+                                       int                 n )
+{
+  const int ch = ms->channels_out;
+  int i, c;
+
+  switch(ms->type_out)
+  {
+  case oyUINT16:
+    for(c = 0; c < 3; ++c)
+      for(i = 0; i < n; ++i)
+      {
+        float v = rgb[c][i] * 65535.0f + 0.5f;
+        ((uint16_t*)out)[i*ch+c] = v <= 0.0f ? 0 :
+                                   v >= 65535.0f ? 65535 : (uint16_t)v;
+      }
+    break;
+  case oyHALF:
+    for(c = 0; c < 3; ++c)
+      for(i = 0; i < n; ++i)
+        ((uint16_t*)out)[i*ch+c] = l2cmsFloatToHalf_( rgb[c][i] );
+    break;
+  case oyFLOAT:
+    for(c = 0; c < 3; ++c)
+      for(i = 0; i < n; ++i)
+        ((float*)out)[i*ch+c] = rgb[c][i];
+    break;
+  case oyDOUBLE:
+    for(c = 0; c < 3; ++c)
+      for(i = 0; i < n; ++i)
+        ((double*)out)[i*ch+c] = rgb[c][i];
+    break;
+  default: break;
+  }
+}
+
+static float   l2cmsMatrixShaperLerp_( const float       * table,
+                                       float               v )
+{
+  float f = v * (l2cmsSHAPER_SIZE - 1);
+  int k = (int)f;
+  return table[k] + (f - k) * (table[k+1] - table[k]);
+}
+
+/* portable kernel, converts in place; pixels with values outside 0-1
+ * are marked with NAN for l2cmsMatrixShaperRun_() */
+static void    l2cmsMatrixShaperCoreC_(const l2cmsMatrixShaper_s * ms,
+                                       float             * r,
+                                       float             * g,
+                                       float             * b,
+                                       int                 n )
+{
+  float * rgb[3] = {r,g,b}, lin[3], o[3], v;
+  int i, c, inside;
+
+  for(i = 0; i < n; ++i)
+  {
+    inside = 1;
+    for(c = 0; c < 3; ++c)
+    {
+      v = rgb[c][i];
+      if(v >= 0.0f && v <= 1.0f)
+        lin[c] = l2cmsMatrixShaperLerp_( ms->in[c], v );
+      else
+        inside = 0;
+    }
+    for(c = 0; c < 3 && inside; ++c)
+    {
+      o[c] = ms->matrix[c][0] * lin[0] + ms->matrix[c][1] * lin[1] +
+             ms->matrix[c][2] * lin[2];
+      if(!(o[c] >= 0.0f && o[c] <= 1.0f))
+        inside = 0;
+    }
+    for(c = 0; c < 3; ++c)
+      rgb[c][i] = inside ? l2cmsMatrixShaperLerp_( ms->out[c], sqrtf( o[c] ) )
+                         : NAN;
+  }
+}
+
+#if defined(l2cmsLUT3D_X86)
+__attribute__((target("avx2")))
+static __m256  l2cmsMatrixShaperLerpAVX2_( const float * table,
+                                       __m256              v )
+{
+  __m256 f = _mm256_mul_ps( v, _mm256_set1_ps( l2cmsSHAPER_SIZE - 1 ) );
+  __m256i k = _mm256_cvttps_epi32( f );
+  __m256 a = _mm256_i32gather_ps( table, k, 4 ),
+         b = _mm256_i32gather_ps( table + 1, k, 4 );
+  return _mm256_add_ps( a, _mm256_mul_ps( _mm256_sub_ps( f, _mm256_cvtepi32_ps( k ) ),
+                                          _mm256_sub_ps( b, a ) ) );
+}
+
+/* eight pixels per iteration; blocks with values outside 0-1 use
+ * l2cmsMatrixShaperCoreC_() */
+__attribute__((target("avx2")))
+static void    l2cmsMatrixShaperCoreAVX2_(const l2cmsMatrixShaper_s * ms,
+                                       float             * r,
+                                       float             * g,
+                                       float             * b,
+                                       int                 n )
+{
+  const __m256 zero = _mm256_setzero_ps(),
+               one = _mm256_set1_ps( 1.0f );
+  float * rgb[3] = {r,g,b};
+  __m256 v[3], lin[3], o[3];
+  int i, c, inside;
+
+  for(i = 0; i + 8 <= n; i += 8)
+  {
+    inside = 0xff;
+    for(c = 0; c < 3; ++c)
+    {
+      v[c] = _mm256_loadu_ps( rgb[c] + i );
+      inside &= _mm256_movemask_ps( _mm256_and_ps(
+                                      _mm256_cmp_ps( v[c], zero, _CMP_GE_OQ ),
+                                      _mm256_cmp_ps( v[c], one, _CMP_LE_OQ ) ) );
+    }
+    if(inside != 0xff)
+    {
+      l2cmsMatrixShaperCoreC_( ms, r + i, g + i, b + i, 8 );
+      continue;
+    }
+
+    for(c = 0; c < 3; ++c)
+      lin[c] = l2cmsMatrixShaperLerpAVX2_( ms->in[c], v[c] );
+    for(c = 0; c < 3; ++c)
+    {
+      o[c] = _mm256_add_ps( _mm256_add_ps(
+                    _mm256_mul_ps( _mm256_set1_ps( ms->matrix[c][0] ), lin[0] ),
+                    _mm256_mul_ps( _mm256_set1_ps( ms->matrix[c][1] ), lin[1] ) ),
+                    _mm256_mul_ps( _mm256_set1_ps( ms->matrix[c][2] ), lin[2] ) );
+      inside &= _mm256_movemask_ps( _mm256_and_ps(
+                                      _mm256_cmp_ps( o[c], zero, _CMP_GE_OQ ),
+                                      _mm256_cmp_ps( o[c], one, _CMP_LE_OQ ) ) );
+    }
+    if(inside != 0xff)
+    {
+      l2cmsMatrixShaperCoreC_( ms, r + i, g + i, b + i, 8 );
+      continue;
+    }
+
+    for(c = 0; c < 3; ++c)
+      _mm256_storeu_ps( rgb[c] + i,
+                        l2cmsMatrixShaperLerpAVX2_( ms->out[c],
+                                                    _mm256_sqrt_ps( o[c] ) ) );
+  }
+
+  if(i < n)
+    l2cmsMatrixShaperCoreC_( ms, r + i, g + i, b + i, n - i );
+}
+#endif /* l2cmsLUT3D_X86 */
+
+/** Function l2cmsMatrixShaperRun_
+ *  @brief   convert one line of interleaved pixels
+ *
+ *  Pixels marked by the kernel are converted by the lcms transform. The
+ *  lines can be converted in place, so those results are kept aside until
+ *  the chunk is stored.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/17
+ *  @since   2026/10/17 (Oyranos: 0.9.7)
+ */
+static void    l2cmsMatrixShaperRun_ ( const l2cmsMatrixShaper_s * ms,
+                                       cmsHTRANSFORM       xform,
+                                       const uint8_t     * in,
+                                       uint8_t           * out,
+                                       int                 n )
+{
+  float r[l2cmsSHAPER_CHUNK], g[l2cmsSHAPER_CHUNK], b[l2cmsSHAPER_CHUNK];
+  float * rgb[3] = {r,g,b};
+  /* up to four doubles per pixel */
+  uint8_t outside[l2cmsSHAPER_CHUNK * 32];
+  int outside_pos[l2cmsSHAPER_CHUNK];
+  const int bpp_in = oyDataTypeGetSize( ms->type_in ) * ms->channels_in,
+            bpp_out = oyDataTypeGetSize( ms->type_out ) * ms->channels_out;
+  int i, j, m, outside_n;
+
+  for(i = 0; i < n; i += l2cmsSHAPER_CHUNK)
+  {
+    m = OY_MIN( l2cmsSHAPER_CHUNK, n - i );
+    l2cmsMatrixShaperLoad_( ms, in + i * bpp_in, rgb, m );
+    ms->core( ms, r, g, b, m );
+
+    outside_n = 0;
+    for(j = 0; j < m; ++j)
+      if(isnan( r[j] ))
+      {
+        uint8_t * px = outside + outside_n * bpp_out;
+        /* keep the extra channels, which lcms does not touch */
+        memcpy( px, out + (i + j) * bpp_out, bpp_out );
+        l2cmsDoTransform( xform, in + (i + j) * bpp_in, px, 1 );
+        outside_pos[outside_n++] = i + j;
+      }
+
+    l2cmsMatrixShaperStore_( ms, rgb, out + i * bpp_out, m );
+    for(j = 0; j < outside_n; ++j)
+      memcpy( out + outside_pos[j] * bpp_out, outside + j * bpp_out, bpp_out );
+  }
+}
+
+/** Function l2cmsMatrixShaperCanHandle_
+ *  @brief   check a pixel layout for the matrix/shaper fast path
+ *
+ *  8-bit is left to lcms, which optimises matrix/shaper pairs itself.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/17
+ *  @since   2026/10/17 (Oyranos: 0.9.7)
+ */
+static int     l2cmsMatrixShaperCanHandle_( oyPixel_t      pixel_layout )
+{
+  int chan_n = oyToChannels_m( pixel_layout );
+  oyDATATYPE_e data_type = oyToDataType_m( pixel_layout );
+
+  return (data_type == oyUINT16 || data_type == oyHALF ||
+          data_type == oyFLOAT || data_type == oyDOUBLE) &&
+         (chan_n == 3 || chan_n == 4) &&
+         oyToColorOffset_m( pixel_layout ) == 0 &&
+         !oyToSwapColorChannels_m( pixel_layout ) &&
+         !oyToPlanar_m( pixel_layout ) &&
+         !oyToFlavor_m( pixel_layout ) &&
+         !oyToByteswap_m( pixel_layout );
+}
+
+/** Function l2cmsMatrixShaperRelease_
+ *  @brief   release a l2cmsMatrixShaper_s
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/17
+ *  @since   2026/10/17 (Oyranos: 0.9.7)
+ */
+static void    l2cmsMatrixShaperRelease_( l2cmsMatrixShaper_s ** ms )
+{
+  if(ms && *ms)
+  {
+    free( *ms );
+    *ms = NULL;
+  }
+}
+
+/** Function l2cmsMatrixShaperCreate_
+ *  @brief   set up the fast path for a matrix/shaper RGB profile pair
+ *
+ *  The matrix is the inverse output colorant matrix times the input
+ *  colorant matrix, as lcms builds it for the colorimetric intents.
+ *  Perceptual and saturation are accepted only for profiles before ICC v4,
+ *  because lcms adds black point compensation for v4 there.
+ *
+ *  @param[in]     p_in                RGB input profile
+ *  @param[in]     p_out               RGB output profile
+ *  @param[in]     intent              rendering intent
+ *  @param[in]     oy_pixel_layout_in  the transforms input layout
+ *  @param[in]     oy_pixel_layout_out the transforms output layout
+ *  @return                            the fast path or NULL
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/17
+ *  @since   2026/10/17 (Oyranos: 0.9.7)
+ */
+static l2cmsMatrixShaper_s * l2cmsMatrixShaperCreate_ (
+                                       cmsHPROFILE         p_in,
+                                       cmsHPROFILE         p_out,
+                                       int                 intent,
+                                       oyPixel_t           oy_pixel_layout_in,
+                                       oyPixel_t           oy_pixel_layout_out )
+{
+  const cmsTagSignature colorants[3] = { cmsSigRedColorantTag,
+                                         cmsSigGreenColorantTag,
+                                         cmsSigBlueColorantTag },
+                        trcs[3] = { cmsSigRedTRCTag, cmsSigGreenTRCTag,
+                                    cmsSigBlueTRCTag };
+  double m_in[3][3], m_out[3][3], inv[3][3], det;
+  l2cmsMatrixShaper_s * ms = NULL;
+  int i, j, k, c;
+
+  if(!p_in || !p_out ||
+     l2cmsGetColorSpace( p_in ) != cmsSigRgbData ||
+     l2cmsGetColorSpace( p_out ) != cmsSigRgbData ||
+     !l2cmsIsMatrixShaper( p_in ) || !l2cmsIsMatrixShaper( p_out ) ||
+     l2cmsIsCLUT( p_in, intent, LCMS_USED_AS_INPUT ) ||
+     l2cmsIsCLUT( p_out, intent, LCMS_USED_AS_OUTPUT ))
+    return NULL;
+
+  if(!(intent == INTENT_RELATIVE_COLORIMETRIC ||
+       ((intent == INTENT_PERCEPTUAL || intent == INTENT_SATURATION) &&
+        l2cmsGetEncodedICCversion( p_in ) < 0x4000000 &&
+        l2cmsGetEncodedICCversion( p_out ) < 0x4000000)))
+    return NULL;
+
+  for(c = 0; c < 3; ++c)
+  {
+    cmsCIEXYZ * xyz_in = (cmsCIEXYZ*) l2cmsReadTag( p_in, colorants[c] ),
+              * xyz_out = (cmsCIEXYZ*) l2cmsReadTag( p_out, colorants[c] );
+    if(!xyz_in || !xyz_out)
+      return NULL;
+    m_in[0][c] = xyz_in->X;  m_in[1][c] = xyz_in->Y;  m_in[2][c] = xyz_in->Z;
+    m_out[0][c] = xyz_out->X; m_out[1][c] = xyz_out->Y; m_out[2][c] = xyz_out->Z;
+  }
+
+  det = m_out[0][0] * (m_out[1][1]*m_out[2][2] - m_out[1][2]*m_out[2][1]) -
+        m_out[0][1] * (m_out[1][0]*m_out[2][2] - m_out[1][2]*m_out[2][0]) +
+        m_out[0][2] * (m_out[1][0]*m_out[2][1] - m_out[1][1]*m_out[2][0]);
+  if(fabs( det ) < 1e-9)
+    return NULL;
+  inv[0][0] =  (m_out[1][1]*m_out[2][2] - m_out[1][2]*m_out[2][1]) / det;
+  inv[0][1] = -(m_out[0][1]*m_out[2][2] - m_out[0][2]*m_out[2][1]) / det;
+  inv[0][2] =  (m_out[0][1]*m_out[1][2] - m_out[0][2]*m_out[1][1]) / det;
+  inv[1][0] = -(m_out[1][0]*m_out[2][2] - m_out[1][2]*m_out[2][0]) / det;
+  inv[1][1] =  (m_out[0][0]*m_out[2][2] - m_out[0][2]*m_out[2][0]) / det;
+  inv[1][2] = -(m_out[0][0]*m_out[1][2] - m_out[0][2]*m_out[1][0]) / det;
+  inv[2][0] =  (m_out[1][0]*m_out[2][1] - m_out[1][1]*m_out[2][0]) / det;
+  inv[2][1] = -(m_out[0][0]*m_out[2][1] - m_out[0][1]*m_out[2][0]) / det;
+  inv[2][2] =  (m_out[0][0]*m_out[1][1] - m_out[0][1]*m_out[1][0]) / det;
+
+  ms = calloc( sizeof(l2cmsMatrixShaper_s), 1 );
+  if(!ms)
+    return NULL;
+
+  for(i = 0; i < 3; ++i)
+    for(j = 0; j < 3; ++j)
+    {
+      double v = 0.0;
+      for(k = 0; k < 3; ++k)
+        v += inv[i][k] * m_in[k][j];
+      ms->matrix[i][j] = (float)v;
+    }
+
+  for(c = 0; c < 3; ++c)
+  {
+    cmsToneCurve * trc_in = (cmsToneCurve*) l2cmsReadTag( p_in, trcs[c] ),
+                 * trc_out = (cmsToneCurve*) l2cmsReadTag( p_out, trcs[c] ),
+                 * reversed = trc_out ? l2cmsReverseToneCurve( trc_out ) : NULL;
+    if(!trc_in || !reversed)
+    {
+      if(reversed) l2cmsFreeToneCurve( reversed );
+      l2cmsMatrixShaperRelease_( &ms );
+      return NULL;
+    }
+
+    for(i = 0; i < l2cmsSHAPER_SIZE; ++i)
+    {
+      float v = (float)i / (l2cmsSHAPER_SIZE - 1);
+      ms->in[c][i] = l2cmsEvalToneCurveFloat( trc_in, v );
+      ms->out[c][i] = l2cmsEvalToneCurveFloat( reversed, v * v );
+    }
+    l2cmsFreeToneCurve( reversed );
+    /* guard entry for interpolating at 1.0 */
+    ms->in[c][l2cmsSHAPER_SIZE] = ms->in[c][l2cmsSHAPER_SIZE - 1];
+    ms->out[c][l2cmsSHAPER_SIZE] = ms->out[c][l2cmsSHAPER_SIZE - 1];
+  }
+
+  ms->type_in = oyToDataType_m( oy_pixel_layout_in );
+  ms->type_out = oyToDataType_m( oy_pixel_layout_out );
+  ms->channels_in = oyToChannels_m( oy_pixel_layout_in );
+  ms->channels_out = oyToChannels_m( oy_pixel_layout_out );
+  ms->core = l2cmsMatrixShaperCoreC_;
+  ms->kernel = "C";
+#if defined(l2cmsLUT3D_X86)
+  __builtin_cpu_init();
+  if(__builtin_cpu_supports( "avx2" ))
+  {
+    ms->core = l2cmsMatrixShaperCoreAVX2_;
+    ms->kernel = "avx2";
+  }
+#endif
+
+  if(oy_debug)
+    l2cms_msg( oyMSG_DBG, NULL, OY_DBG_FORMAT_
+               " matrix/shaper fast path: %s->%s kernel: %s",
+               OY_DBG_ARGS_, oyDataTypeToText( ms->type_in ),
+               oyDataTypeToText( ms->type_out ), ms->kernel );
+
+  return ms;
+}
+
 /** Function l2cmsCMMDeleteTransformWrap
  *  @brief
  *
@@ -907,6 +2018,8 @@ int l2cmsCMMDeleteTransformWrap(oyPointer * wrap)
 
     l2cmsDeleteTransform (s->l2cms);
     s->l2cms = 0;
+    l2cmsLut3dRelease_( &s->lut3d );
+    l2cmsMatrixShaperRelease_( &s->matrix_shaper );
 
     free(s);
 
@@ -1043,6 +2156,8 @@ uint32_t       l2cmsFlagsFromOptions  ( oyOptions_s       * opts )
       case 1: flags |= cmsFLAGS_NOOPTIMIZE; break;
       case 2: flags |= cmsFLAGS_HIGHRESPRECALC; break;
       case 3: flags |= cmsFLAGS_LOWRESPRECALC; break;
+      /* native 3D LUT; sampled from the normally optimised transform */
+      case 4: flags |= 0; break;
       }
 
       if(l2cmsGetEncodedCMMversion() >= 2070)
@@ -1070,9 +2185,12 @@ uint16_t in[4] = {32000,32000,32000,0}, out[4] = {65535,65535,65535,65535};
 /** Function l2cmsCMMConversionContextCreate_
  *  @brief   create a CMM transform
  *
- *  @version Oyranos: 0.3.3
+ *  The transform is created in the context of the calling thread.
+ *  @see l2cmsThreadContext_()
+ *
+ *  @version Oyranos: 0.9.7
  *  @since   2008/12/28 (Oyranos: 0.1.10)
- *  @date    2011/11/18
+ *  @date    2026/10/17
  */
 cmsHTRANSFORM  l2cmsCMMConversionContextCreate_ (
                                        oyFilterNode_s    * node,
@@ -1104,6 +2222,7 @@ cmsHTRANSFORM  l2cmsCMMConversionContextCreate_ (
   const char * o_txt = 0;
   double adaption_state = 0.0;
   int multi_profiles_n = profiles_n;
+  cmsContext tc = l2cmsThreadContext_();
 
   if(!lps || !profiles_n || !oy_pixel_layout_in || !oy_pixel_layout_out)
     return 0;
@@ -1157,7 +2276,7 @@ cmsHTRANSFORM  l2cmsCMMConversionContextCreate_ (
         csp = T_COLORSPACE(l2cms_pixel_layout_out);
         l2cms_pixel_layout_out &= (~COLORSPACE_SH( csp ));
 #endif
-        xform = l2cmsCreateTransform( lps[0], l2cms_pixel_layout_in,
+        xform = l2cmsCreateTransformTHR( tc, lps[0], l2cms_pixel_layout_in,
                                      0, l2cms_pixel_layout_out,
                                      (intent > 3)?0:intent,
                                      flags | cmsFLAGS_KEEP_SEQUENCE );
@@ -1171,7 +2290,7 @@ cmsHTRANSFORM  l2cmsCMMConversionContextCreate_ (
       bpc[0] = flags & cmsFLAGS_BLACKPOINTCOMPENSATION;
       bpc[1] = flags & cmsFLAGS_BLACKPOINTCOMPENSATION;
       adaption_states[0] = adaption_state; adaption_states[1] = adaption_state;
-      xform = l2cmsCreateExtendedTransform( 0, profiles_n, lps, bpc,
+      xform = l2cmsCreateExtendedTransform( tc, profiles_n, lps, bpc,
                                           intents, adaption_states, NULL, 0,
                                           l2cms_pixel_layout_in,
                                           l2cms_pixel_layout_out, flags | cmsFLAGS_KEEP_SEQUENCE );
@@ -1192,7 +2311,7 @@ cmsHTRANSFORM  l2cmsCMMConversionContextCreate_ (
         {
           l2cmsProfileWrap_s * wrap = l2cmsAddProofProfile( 
                                              oyProfiles_Get(simulation,i),flags,
-                                             intent, intent_proof, 0);
+                                             intent, intent_proof, 0, 1);
           merge[profiles_n-1 + i] = wrap->l2cms;
         }
 
@@ -1225,7 +2344,7 @@ cmsHTRANSFORM  l2cmsCMMConversionContextCreate_ (
       SET_ARR(intents,intent,multi_profiles_n);
       SET_ARR(bpc,flags & cmsFLAGS_BLACKPOINTCOMPENSATION,multi_profiles_n);
       SET_ARR(adaption_states,adaption_state,multi_profiles_n);
-      xform = l2cmsCreateExtendedTransform( 0, multi_profiles_n, lps, bpc,
+      xform = l2cmsCreateExtendedTransform( tc, multi_profiles_n, lps, bpc,
                                           intents, adaption_states, NULL, 0,
                                           l2cms_pixel_layout_in,
                                           l2cms_pixel_layout_out, flags | cmsFLAGS_KEEP_SEQUENCE );
@@ -1303,9 +2422,56 @@ cmsHTRANSFORM  l2cmsCMMConversionContextCreate_ (
              OY_DBG_ARGS_ );
 
   if(!error && ltw && oy)
+  {
     *ltw= l2cmsTransformWrap_Set_( xform, color_in, color_out,
                                   oy_pixel_layout_in, oy_pixel_layout_out, oy );
 
+    o_txt = oyOptions_FindString  ( opts, "precalculation", 0 );
+    if(*ltw && o_txt && atoi( o_txt ) == 4 &&
+       l2cmsLut3dCanHandle_( oy_pixel_layout_in, color_in ) &&
+       l2cmsLut3dCanHandle_( oy_pixel_layout_out, color_out ))
+      (*ltw)->lut3d = l2cmsLut3dCreate_( xform, oy_pixel_layout_in,
+                                         oy_pixel_layout_out );
+
+    /* matrix/shaper RGB pairs without extra profiles or options in between */
+    if(*ltw && !(*ltw)->lut3d &&
+       !(flags & (cmsFLAGS_NOOPTIMIZE | cmsFLAGS_BLACKPOINTCOMPENSATION |
+                  cmsFLAGS_GAMUTCHECK | cmsFLAGS_SOFTPROOFING)) &&
+       flags & cmsFLAGS_NOWHITEONWHITEFIXUP &&
+       l2cmsMatrixShaperCanHandle_( oy_pixel_layout_in ) &&
+       l2cmsMatrixShaperCanHandle_( oy_pixel_layout_out ))
+    {
+      cmsHPROFILE pair[2] = {NULL, NULL};
+
+      if(profiles_n == 2 && !proof_n)
+      {
+        pair[0] = lps[0];
+        pair[1] = lps[1];
+      } else
+      if(profiles_n == 1 && profile_class_in == icSigLinkClass && node)
+        l2cmsFilterNode_GetProfilePair_( node, pair );
+
+      if(pair[0] && pair[1])
+        (*ltw)->matrix_shaper = l2cmsMatrixShaperCreate_( pair[0], pair[1],
+                                                          intent,
+                                                          oy_pixel_layout_in,
+                                                          oy_pixel_layout_out );
+    }
+
+    /* tell observers about the selected path */
+    if(*ltw && node && ((*ltw)->lut3d || (*ltw)->matrix_shaper))
+    {
+      oyOptions_s * node_tags = oyFilterNode_GetTags( node );
+      if((*ltw)->lut3d)
+        oyOptions_SetFromString( &node_tags, "////lut3d",
+                                 (*ltw)->lut3d->kernel, OY_CREATE_NEW );
+      else
+        oyOptions_SetFromString( &node_tags, "////matrix_shaper",
+                                 (*ltw)->matrix_shaper->kernel, OY_CREATE_NEW );
+      oyOptions_Release( &node_tags );
+    }
+  }
+
   end:
   return xform;
 }
@@ -1452,16 +2618,19 @@ oyConnectorImaging_s_* l2cms_cmmIccPlug_connectors[2]={&l2cms_cmmIccPlug_connect
  *  Look in the Oyranos cache for a CMM internal representation or generate a
  *  new abstract profile containing the proofing profiles changes. This can be
  *  a proofing color space simulation or out of gamut marking.
+ *  With batch set to zero, the profile is sampled point wise through
+ *  lcm2SamplerProof(), which serves as reference for the batched grid.
  *
- *  @version Oyranos: 0.9.6
- *  @date    2016/05/02
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/17
  *  @since   2009/11/05 (Oyranos: 0.1.10)
  */
 l2cmsProfileWrap_s*l2cmsAddProofProfile( oyProfile_s     * proof,
                                        cmsUInt32Number     flags,
                                        int                 intent,
                                        int                 intent_proof,
-                                       uint32_t            icc_profile_flags )
+                                       uint32_t            icc_profile_flags,
+                                       int                 batch )
 {
   int error = 0;
   cmsHPROFILE * hp = 0;
@@ -1491,10 +2660,20 @@ l2cmsProfileWrap_s*l2cmsAddProofProfile( oyProfile_s     * proof,
   sprintf( num, "%d|%d|%d", (int)flags, (flags & cmsFLAGS_GAMUTCHECK)?1:0,
                                         (flags & cmsFLAGS_SOFTPROOFING)?1:0 );
   STRING_ADD( hash_text, num );
+  STRING_ADD( hash_text, " batch:" );
+  sprintf( num, "%d", batch ? 1 : 0 );
+  STRING_ADD( hash_text, num );
 
   /* cache look up */
   cmm_ptr = oyPointer_LookUpFromText( hash_text, l2cmsPROFILE );
+  if(!cmm_ptr)
+  {
+    oyFree_m_(hash_text);
+    return 0;
+  }
 
+  /* node contexts may be prepared concurrently; open only once */
+  oyObject_Lock( cmm_ptr->oy_, __FILE__, __LINE__ );
   oyPointer_Set( cmm_ptr, CMM_NICK, 0,0,0,0 );
 
   /* for empty profile create a new abstract one */
@@ -1517,7 +2696,8 @@ l2cmsProfileWrap_s*l2cmsAddProofProfile( oyProfile_s     * proof,
              OY_DBG_ARGS_, hash_text );
  
     /* create */
-    hp = l2cmsGamutCheckAbstract( proof, flags, intent, intent_proof, icc_profile_flags );
+    hp = l2cmsGamutCheckAbstract( proof, flags, intent, intent_proof,
+                                  icc_profile_flags, batch );
     if(hp)
     {
       /* save to memory */
@@ -1544,6 +2724,7 @@ l2cmsProfileWrap_s*l2cmsAddProofProfile( oyProfile_s     * proof,
                           l2cmsPROFILE, s, CMMToString_M(CMMProfileOpen_M),
                           l2cmsCMMProfileReleaseWrap );
   }
+  oyObject_UnLock( cmm_ptr->oy_, __FILE__, __LINE__ );
 
   if(!error)
   {
@@ -1571,9 +2752,9 @@ l2cmsProfileWrap_s*l2cmsAddProofProfile( oyProfile_s     * proof,
  *
  *  Look in the Oyranos cache for a CMM internal representation
  *
- *  @version Oyranos: 0.1.10
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/17
  *  @since   2008/12/28 (Oyranos: 0.1.10)
- *  @date    2008/12/28
  */
 cmsHPROFILE  l2cmsAddProfile          ( oyProfile_s       * p )
 {
@@ -1604,10 +2785,13 @@ cmsHPROFILE  l2cmsAddProfile          ( oyProfile_s       * p )
     return 0;
   }
 
+  /* node contexts may be prepared concurrently; open only once */
+  oyObject_Lock( cmm_ptr->oy_, __FILE__, __LINE__ );
   oyPointer_Set( cmm_ptr, CMM_NICK, 0,0,0,0 );
 
   if(!oyPointer_GetPointer(cmm_ptr))
     error = l2cmsCMMData_Open( (oyStruct_s*)p, cmm_ptr );
+  oyObject_UnLock( cmm_ptr->oy_, __FILE__, __LINE__ );
 
   if(error)
   {
@@ -1787,6 +2971,96 @@ oyProfiles_s * l2cmsProfilesFromOptions( oyFilterNode_s * node, oyFilterPlug_s *
   return profiles;
 }
 
+/** Function l2cmsFilterNode_GetProfilePair_
+ *  @brief   get the two image profiles of a plain node
+ *
+ *  The device link for a node contains only the input and output image
+ *  profiles, as long as no intermediate, effect, simulation or display
+ *  profile is requested. See l2cmsFilterNode_CmmIccContextToMem().
+ *
+ *  @param[in]     node                the ICC filter node
+ *  @param[out]    pair                the cached lcms input and output profile
+ *  @return                            0 - success, 1 - error, -1 - more profiles
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/17
+ *  @since   2026/10/17 (Oyranos: 0.9.7)
+ */
+int      l2cmsFilterNode_GetProfilePair_ (
+                                       oyFilterNode_s    * node,
+                                       cmsHPROFILE       * pair )
+{
+  int error = !node || !pair;
+  oyFilterPlug_s * plug = NULL;
+  oyFilterSocket_s * socket = NULL,
+                   * remote_socket = NULL;
+  oyImage_s * image_input = NULL,
+            * image_output = NULL;
+  oyProfile_s * image_input_profile = NULL,
+              * image_output_profile = NULL;
+  oyOptions_s * node_options = NULL;
+  oyProfiles_s * profiles = NULL;
+  int effect_switch, proof, n;
+
+  if(error)
+    return error;
+
+  pair[0] = pair[1] = NULL;
+  plug = oyFilterNode_GetPlug( node, 0 );
+  socket = oyFilterNode_GetSocket( node, 0 );
+  remote_socket = oyFilterPlug_GetSocket( plug );
+  node_options = oyFilterNode_GetOptions( node, 0 );
+
+  effect_switch = oyOptions_FindString( node_options, "effect_switch", "1" ) ? 1 : 0;
+  profiles = l2cmsProfilesFromOptions( node, plug, node_options,
+                                       "profiles_effect", effect_switch, 0 );
+  n = oyProfiles_Count( profiles );
+  oyProfiles_Release( &profiles );
+
+  proof = oyOptions_FindString( node_options, "proof_soft", "1" ) ? 1 : 0;
+  proof += oyOptions_FindString( node_options, "proof_hard", "1" ) ? 1 : 0;
+  profiles = l2cmsProfilesFromOptions( node, plug, node_options,
+                                       "profiles_simulation", proof, 0 );
+  n += oyProfiles_Count( profiles );
+  oyProfiles_Release( &profiles );
+
+  n += oyOptions_CountType( node_options, "display.abstract.icc_profile",
+                            oyOBJECT_PROFILE_S );
+
+  profiles = l2cmsProfilesFromOptions( node, plug, node_options,
+                                       "profiles_intermediate", 1, 0 );
+  n += oyProfiles_Count( profiles );
+  oyProfiles_Release( &profiles );
+
+  if(n)
+    error = -1;
+  else
+  {
+    image_input = (oyImage_s*)oyFilterSocket_GetData( remote_socket );
+    image_output = (oyImage_s*)oyFilterSocket_GetData( socket );
+    image_input_profile = oyImage_GetProfile( image_input );
+    image_output_profile = oyImage_GetProfile( image_output );
+    if(image_input_profile && image_output_profile)
+    {
+      pair[0] = l2cmsAddProfile( image_input_profile );
+      pair[1] = l2cmsAddProfile( image_output_profile );
+    }
+    if(!pair[0] || !pair[1])
+      error = 1;
+  }
+
+  oyProfile_Release( &image_input_profile );
+  oyProfile_Release( &image_output_profile );
+  oyImage_Release( &image_input );
+  oyImage_Release( &image_output );
+  oyOptions_Release( &node_options );
+  oyFilterSocket_Release( &remote_socket );
+  oyFilterSocket_Release( &socket );
+  oyFilterPlug_Release( &plug );
+
+  return error;
+}
+
 /** l2cmsFilterNode_CmmIccContextToMem()
  *  @brief   implement oyCMMFilterNode_CreateContext_f()
  *
@@ -1817,7 +3091,8 @@ oyPointer l2cmsFilterNode_CmmIccContextToMem (
               * image_input_profile,
               * image_output_profile;
   oyProfiles_s * profiles = 0,
-               * profs = 0;
+               * profs = 0,
+               * intermediates = 0;
   oyProfileTag_s * psid = 0,
                  * info = 0,
                  * cprt = 0;
@@ -1860,7 +3135,11 @@ oyPointer l2cmsFilterNode_CmmIccContextToMem (
              OY_DBG_FORMAT_" can not handle oyHALF", OY_DBG_ARGS_ );
   }*/
 
-  len = sizeof(cmsHPROFILE) * (15 + 2 + 1);
+  /* colour spaces of merged nodes, see OY_PROFILES_INTERMEDIATE */
+  intermediates = l2cmsProfilesFromOptions( node, plug, node_options,
+                                            "profiles_intermediate", 1, verbose );
+
+  len = sizeof(cmsHPROFILE) * (15 + 2 + 1 + 2 * oyProfiles_Count( intermediates ));
   lps = oyAllocateFunc_( len );
   if(!lps)
     goto l2cmsFilterNode_CmmIccContextToMemClean;
@@ -1878,6 +3157,16 @@ oyPointer l2cmsFilterNode_CmmIccContextToMem (
   profs = oyProfiles_New( 0 );
   error = oyProfiles_MoveIn( profs, &p, -1 );
 
+  /* intermediate profiles: leave to and enter from each colour space */
+  n = oyProfiles_Count( intermediates );
+  for(i = 0; i < n; ++i)
+  {
+    p = oyProfiles_Get( intermediates, i );
+    lps[ profiles_n++ ] = l2cmsAddProfile( p );
+    lps[ profiles_n++ ] = l2cmsAddProfile( p );
+    error = oyProfiles_MoveIn( profs, &p, -1 );
+  }
+
   /* effect profiles */
   effect_switch = oyOptions_FindString  ( node_options, "effect_switch", "1" ) ? 1 : 0;
   profiles = l2cmsProfilesFromOptions( node, plug, node_options,
@@ -2121,6 +3410,7 @@ l2cmsFilterNode_CmmIccContextToMemClean:
   oyOptions_Release( &node_options );
   oyProfiles_Release( &profs );
   oyProfiles_Release( &profiles );
+  oyProfiles_Release( &intermediates );
   oyFree_m_( lps );
 
   if(verbose || oy_debug)
@@ -2287,6 +3577,24 @@ char * l2cmsFilterNode_GetText       ( oyFilterNode_s    * node,
     }
     oyOptions_Release( &options );
 
+    /* the model misses short "////" keys, which select the transform and
+     * the native paths; the transform is created for both pixel layouts.
+     * The keys differ from the option names, which the DL Info tag lists */
+    oyStringAddPrintf_( &temp, oyAllocateFunc_, oyDeAllocateFunc_,
+                        " \"pixel_layout\": \"%u %u\",\n"
+                        " \"flags\": \"%d\",\n"
+                        " \"intent\": \"%s\",\n"
+                        " \"precalculation\": \"%s\",\n",
+                        in_image ? (unsigned)oyImage_GetPixelLayout( in_image, oyLAYOUT ) : 0,
+                        out_image ? (unsigned)oyImage_GetPixelLayout( out_image, oyLAYOUT ) : 0,
+                        l2cmsFlagsFromOptions( node_opts ),
+                        oyNoEmptyString_m_(
+                          oyOptions_FindString( node_opts, "rendering_intent", 0 ) ),
+                        oyNoEmptyString_m_(
+                          oyOptions_FindString( node_opts, "precalculation", 0 ) ) );
+    hashTextAdd_m( temp );
+    oyDeAllocateFunc_(temp); temp = 0;
+
     /* abstract profiles */
     proof = oyOptions_FindString  ( node_opts, "proof_soft", "1" ) ? 1 : 0;
     proof += oyOptions_FindString  ( node_opts, "proof_hard", "1" ) ? 1 : 0;
@@ -2311,6 +3619,24 @@ char * l2cmsFilterNode_GetText       ( oyFilterNode_s    * node,
     }
     oyProfiles_Release( &profiles );
 
+    profiles = l2cmsProfilesFromOptions( node, plug, node_opts, "profiles_intermediate", 1, verbose );
+    n = oyProfiles_Count( profiles );
+    for(i = 0; i < n; ++i)
+    {
+      p = oyProfiles_Get( profiles, i );
+      model = oyProfile_GetText( p, oyNAME_JSON );
+      oyProfile_Release( &p );
+
+      if(i==0)
+        hashTextAdd_m(  " \"icc_profile.intermediate\": [\n" );
+      else
+        hashTextAdd_m(    ",\n  " );
+      hashTextAdd_m( model );
+      if(i+1 == n)
+        hashTextAdd_m(  " ],\n" );
+    }
+    oyProfiles_Release( &profiles );
+
     for(i = 0; i < profiles_display_n; ++i)
     {
       oyOption_s * o = NULL;
@@ -2531,6 +3857,105 @@ int  l2cmsModuleData_Convert          ( oyPointer_s       * data_in,
 
 char * oyCMMCacheListPrint_();
 
+/** pixels per l2cmsDoTransform() call in l2cmsTransformLine_() */
+#define l2cmsXYZ_CHUNK 256
+
+/* scale the XYZ channels from in into out; in place or copying the
+ * remaining channels along */
+static void    l2cmsScaleXYZ_        ( oyDATATYPE_e        data_type,
+                                       const uint8_t     * in,
+                                       uint8_t           * out,
+                                       int                 channels,
+                                       int                 offset,
+                                       int                 n,
+                                       double              factor )
+{
+  int i, c;
+
+  if(data_type == oyFLOAT)
+  {
+    const float * src = (const float*) in;
+    float * dst = (float*) out,
+          f = (float) factor;
+    for(i = 0; i < n; ++i, src += channels, dst += channels)
+      for(c = 0; c < channels; ++c)
+        if(offset <= c && c < offset + 3)
+          dst[c] = src[c] * f;
+        else if(in != out)
+          dst[c] = src[c];
+  } else
+  if(data_type == oyDOUBLE)
+  {
+    const double * src = (const double*) in;
+    double * dst = (double*) out;
+    for(i = 0; i < n; ++i, src += channels, dst += channels)
+      for(c = 0; c < channels; ++c)
+        if(offset <= c && c < offset + 3)
+          dst[c] = src[c] * factor;
+        else if(in != out)
+          dst[c] = src[c];
+  }
+}
+
+/** Function l2cmsTransformLine_
+ *  @brief   run l2cmsDoTransform() over one line
+ *
+ *  Floating point XYZ is scaled between the Oyranos and lcms ranges.
+ *  This happens in chunks small enough to stay in the CPU cache, so
+ *  that input scaling, transform and output scaling touch the pixels
+ *  only once. Only the XYZ channels are scaled.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/17
+ *  @since   2026/10/17 (Oyranos: 0.9.7)
+ */
+static void    l2cmsTransformLine_   ( l2cmsTransformWrap_s * ltw,
+                                       const uint8_t     * in,
+                                       uint8_t           * out,
+                                       int                 n )
+{
+  /* lcms float XYZ is 0.0 - 1.0 for 0.0 - 1.99997 */
+  const double xyz_factor = 1.0 + 32767.0/32768.0;
+  oyDATATYPE_e type_in = oyToDataType_m( ltw->oy_pixel_layout_in ),
+               type_out = oyToDataType_m( ltw->oy_pixel_layout_out );
+  int scale_in = ltw->sig_in == icSigXYZData &&
+                 (type_in == oyFLOAT || type_in == oyDOUBLE),
+      scale_out = ltw->sig_out == icSigXYZData &&
+                 (type_out == oyFLOAT || type_out == oyDOUBLE);
+  int channels_in = oyToChannels_m( ltw->oy_pixel_layout_in ),
+      channels_out = oyToChannels_m( ltw->oy_pixel_layout_out ),
+      bpp_in = oyDataTypeGetSize( type_in ) * channels_in,
+      bpp_out = oyDataTypeGetSize( type_out ) * channels_out;
+  double tmp[l2cmsXYZ_CHUNK * cmsMAXCHANNELS];
+  int i, m;
+
+  if(!scale_in && !scale_out)
+  {
+    l2cmsDoTransform( ltw->l2cms, in, out, n );
+    return;
+  }
+
+  for(i = 0; i < n; i += l2cmsXYZ_CHUNK)
+  {
+    const uint8_t * src = in + (size_t)i * bpp_in;
+    uint8_t * dst = out + (size_t)i * bpp_out;
+
+    m = OY_MIN( l2cmsXYZ_CHUNK, n - i );
+    if(scale_in)
+    {
+      l2cmsScaleXYZ_( type_in, src, (uint8_t*)tmp, channels_in,
+                      oyToColorOffset_m( ltw->oy_pixel_layout_in ), m,
+                      1.0 / xyz_factor );
+      src = (const uint8_t*)tmp;
+    }
+    l2cmsDoTransform( ltw->l2cms, src, dst, m );
+    if(scale_out)
+      l2cmsScaleXYZ_( type_out, dst, dst, channels_out,
+                      oyToColorOffset_m( ltw->oy_pixel_layout_out ), m,
+                      xyz_factor );
+  }
+}
+
 /** Function l2cmsFilterPlug_CmmIccRun
  *  @brief   implement oyCMMFilterPlug_GetNext_f()
  *
@@ -2541,12 +3966,11 @@ char * oyCMMCacheListPrint_();
 int      l2cmsFilterPlug_CmmIccRun   ( oyFilterPlug_s    * requestor_plug,
                                        oyPixelAccess_s   * ticket )
 {
-  int j, k, n;
+  int k, n;
   int error = 0;
   oyDATATYPE_e data_type_in = 0,
                data_type_out = 0;
   int channels_out, channels_in;
-  int bps_in;
   oyPixel_t pixel_layout_in,
             layout_out;
 
@@ -2595,7 +4019,8 @@ int      l2cmsFilterPlug_CmmIccRun   ( oyFilterPlug_s    * requestor_plug,
       /* Use original pixel size for being save and do not fiddle with ROI's */
       int w = oyArray2d_GetDataGeo1( old_a, 2 ) / channels_out;
       int h = oyArray2d_GetDataGeo1( old_a, 3 );
-      a = oyArray2d_Create( NULL, w * channels_in,h, oyToDataType_m( pixel_layout_in ), ticket->oy_ );
+      /* pooled block, as this happens on each run */
+      a = oyArray2d_CreateAligned( w * channels_in,h, oyToDataType_m( pixel_layout_in ), ticket->oy_ );
       if(oy_debug)
       {
         l2cms_msg( oy_debug?oyMSG_WARN:oyMSG_DBG, (oyStruct_s*)ticket, OY_DBG_FORMAT_"layout_out(%d) != layout_in(%d) created %s",
@@ -2639,7 +4064,6 @@ int      l2cmsFilterPlug_CmmIccRun   ( oyFilterPlug_s    * requestor_plug,
               _("Image"), oyStruct_GetId( (oyStruct_s*)image_output ) );
 
   data_type_in = oyToDataType_m( oyImage_GetPixelLayout( image_input, oyLAYOUT ) );
-  bps_in = oyDataTypeGetSize( data_type_in );
 
   /*if(data_type_in == oyHALF)
   {
@@ -2734,12 +4158,6 @@ int      l2cmsFilterPlug_CmmIccRun   ( oyFilterPlug_s    * requestor_plug,
   /* now do some position blind manipulations */
   if(ltw && error <= 0)
   {
-    uint8_t * array_in_tmp = 0,
-            * array_out_tmp = 0;
-    float * array_in_tmp_flt = 0,
-          * array_out_tmp_flt = 0;
-    double * array_in_tmp_dbl = 0,
-           * array_out_tmp_dbl = 0;
     uint8_t ** array_in_data = oyArray2d_GetData( array_in ),
             ** array_out_data = oyArray2d_GetData( array_out );
     int threads_n = 
@@ -2750,7 +4168,6 @@ int      l2cmsFilterPlug_CmmIccRun   ( oyFilterPlug_s    * requestor_plug,
 #endif
     int w_in =  (int)(oyArray2d_GetWidth(array_in)+0.5),
         w_out = (int)(oyArray2d_GetWidth(array_out)+0.5);
-    int stride_in = w_in * bps_in;
 
     n = OY_MIN(w_in/channels_in, w_out/channels_out);
 
@@ -2774,130 +4191,53 @@ int      l2cmsFilterPlug_CmmIccRun   ( oyFilterPlug_s    * requestor_plug,
       error = 1;
     }
     
-    if(ltw->sig_in  == icSigXYZData &&
-       (data_type_in == oyFLOAT ||
-        data_type_in == oyDOUBLE))
-    {
-      array_in_tmp = oyAllocateFunc_( stride_in * threads_n );
-      if(data_type_in == oyFLOAT)
-        array_in_tmp_flt = (float*) array_in_tmp;
-      else if(data_type_in == oyDOUBLE)
-        array_in_tmp_dbl = (double*) array_in_tmp;
-    }
-    if(ltw->sig_out  == icSigXYZData &&
-       (data_type_out == oyFLOAT ||
-        data_type_out == oyDOUBLE))
-    {
-      array_out_tmp = array_out_data[0];
-    }
-    
-
     /*  - - - - - conversion - - - - - */
     /*l2cms_msg(oyMSG_WARN,(oyStruct_s*)ticket, "%s: %d Start lines: %d",
             __FILE__,__LINE__, array_out->height);*/
     if(!error)
     {
-      const double xyz_factor = 1.0 + 32767.0/32768.0;
-      const int use_xyz_scale = 1;
-      int index = 0;
       int array_in_height = oyArray2d_GetHeight(array_in),
           array_out_height = oyArray2d_GetHeight(array_out),
           lines = OY_MIN(array_in_height, array_out_height);
-      if(lines > threads_n * 10)
+      if(ltw->lut3d && data_type_in == oyUINT8 && data_type_out == oyUINT8)
       {
+        double trace = oyTraceBegin();
 #if defined(USE_OPENMP)
-#pragma omp parallel for private(index,j,array_in_tmp_flt,array_in_tmp_dbl,array_out_tmp_flt,array_out_tmp_dbl)
+#pragma omp parallel for if(lines > threads_n * 10)
 #endif
         for( k = 0; k < lines; ++k)
-        {
-          if(array_in_tmp && use_xyz_scale)
-          {
-#if defined(_OPENMP) && defined(USE_OPENMP)
-            index = omp_get_thread_num();
+          ltw->lut3d->run( ltw->lut3d, array_in_data[k], array_out_data[k], n );
+        if(trace)
+          oyTraceEnd( trace, "l2cmsLut3d lines", CMM_NICK, -1 );
+      } else
+      if(ltw->matrix_shaper && data_type_in == ltw->matrix_shaper->type_in &&
+         data_type_out == ltw->matrix_shaper->type_out)
+      {
+        double trace = oyTraceBegin();
+#if defined(USE_OPENMP)
+#pragma omp parallel for if(lines > threads_n * 10)
 #endif
-            memcpy( &array_in_tmp[stride_in*index], array_in_data[k],
-                    w_in * bps_in );
-            if(data_type_in == oyFLOAT)
-            {
-              array_in_tmp_flt = (float*) &array_in_tmp[stride_in*index];
-              for(j = 0; j < w_in; ++j)
-              {
-                array_in_tmp_flt[j] /= xyz_factor;
-              }
-            } else
-            if(data_type_in == oyDOUBLE)
-            {
-              array_in_tmp_dbl = (double*) &array_in_tmp[stride_in*index];
-              for(j = 0; j < w_in; ++j)
-              {
-                array_in_tmp_dbl[j] /= xyz_factor;
-              }
-            }
-            l2cmsDoTransform( ltw->l2cms, &array_in_tmp[stride_in*index],
-                                       array_out_data[k], n );
-          } else
-            l2cmsDoTransform( ltw->l2cms, array_in_data[k],
-                                       array_out_data[k], n );
-          if(array_out_tmp && use_xyz_scale)
-          {
-            if(data_type_out == oyFLOAT)
-            {
-              array_out_tmp_flt = (float*) array_out_data[k];
-              for(j = 0; j < w_out; ++j)
-                array_out_tmp_flt[j] *= xyz_factor;
-            } else
-            if(data_type_out == oyDOUBLE)
-            {
-              array_out_tmp_dbl = (double*) array_out_data[k];
-              for(j = 0; j < w_out; ++j)
-                array_out_tmp_dbl[j] *= xyz_factor;
-            }
-          }
-        }
+        for( k = 0; k < lines; ++k)
+          l2cmsMatrixShaperRun_( ltw->matrix_shaper, ltw->l2cms,
+                                 array_in_data[k],
+                                 array_out_data[k], n );
+        if(trace)
+          oyTraceEnd( trace, "l2cmsMatrixShaper lines", CMM_NICK, -1 );
       } else
+      {
+        double trace = oyTraceBegin();
+#if defined(USE_OPENMP)
+#pragma omp parallel for if(lines > threads_n * 10)
+#endif
         for( k = 0; k < lines; ++k)
-        {
-          if(array_in_tmp && use_xyz_scale)
-          {
-            memcpy( array_in_tmp, array_in_data[k], w_in * bps_in );
-            if(data_type_in == oyFLOAT)
-            for(j = 0; j < w_in; ++j)
-            {
-              array_in_tmp_flt[j] /= xyz_factor;
-            }
-            if(data_type_in == oyDOUBLE)
-            for(j = 0; j < w_in; ++j)
-            {
-              array_in_tmp_dbl[j] /= xyz_factor;
-            }
-            l2cmsDoTransform( ltw->l2cms, array_in_tmp,
-                                       array_out_data[k], n );
-          } else
-            l2cmsDoTransform( ltw->l2cms, array_in_data[k],
-                                       array_out_data[k], n );
-          if(array_out_tmp && use_xyz_scale)
-          {
-            if(data_type_out == oyFLOAT)
-            {
-              array_out_tmp_flt = (float*) array_out_data[k];
-              for(j = 0; j < w_out; ++j)
-                array_out_tmp_flt[j] *= xyz_factor;
-            } else
-            if(data_type_out == oyDOUBLE)
-            {
-              array_out_tmp_dbl = (double*) array_out_data[k];
-              for(j = 0; j < w_out; ++j)
-                array_out_tmp_dbl[j] *= xyz_factor;
-            }
-          }
-        }
+          l2cmsTransformLine_( ltw, array_in_data[k], array_out_data[k], n );
+        if(trace)
+          oyTraceEnd( trace, "l2cmsDoTransform lines", CMM_NICK, -1 );
+      }
     /*l2cms_msg(oyMSG_WARN,(oyStruct_s*)ticket, "%s: %d End width: %d",
             __FILE__,__LINE__, n);*/
     }
 
-    if(array_in_tmp)
-      oyDeAllocateFunc_( array_in_tmp );
-
     if(getenv("OY_DEBUG_WRITE"))
     {
       char * t = 0; oyStringAddPrintf( &t, 0,0,
@@ -3111,6 +4451,10 @@ int l2cmsGetOptionsUI                ( oyCMMapiFilter_s   * module OY_UNUSED,
         <xf:value>3</xf:value>\n\
         <xf:label>LCMS2_LOWRESPRECALC</xf:label>\n\
        </xf:item>\n\
+       <xf:item>\n\
+        <xf:value>4</xf:value>\n\
+        <xf:label>OY_RGB8_LUT3D</xf:label>\n\
+       </xf:item>\n\
       </xf:choices>\n\
      </xf:select1>\n");
   A("\
@@ -3370,6 +4714,20 @@ oyCMMapi10_s_    l2cms_api10_cmm5 = {
 
 const char *l2cms_texts_profile_create[4] = {"can_handle","create_profile","help",0};
 
+/* read the optional "grid_points" LUT size */
+static int l2cmsGridPoints           ( oyOptions_s       * options )
+{
+  int32_t grid_points = l2cmsWHITE_POINT_LUT_GRID;
+  if(oyOptions_FindInt( options, "grid_points", 0, &grid_points ) == 0 &&
+     (grid_points < 2 || grid_points > 255))
+  {
+    l2cms_msg( oyMSG_WARN, (oyStruct_s*)options, OY_DBG_FORMAT_
+               "ignoring \"grid_points\": %d", OY_DBG_ARGS_, grid_points );
+    grid_points = l2cmsWHITE_POINT_LUT_GRID;
+  }
+  return grid_points;
+}
+
 /* OY_LCM2_CREATE_ABSTRACT_WHITE_POINT_BRADFORD_REGISTRATION -------------------------- */
 
 /** Function lcm2AbstractWhitePointBradford
@@ -3381,16 +4739,18 @@ const char *l2cms_texts_profile_create[4] = {"can_handle","create_profile","help
  *
  *  @param         src_iccXYZ          the source white point
  *  @param         illu_iccXYZ         the illumination white point
+ *  @param         grid_size           the LUT grid points per channel
  *  @param         icc_profile_flags   profile flags
  *  @param         file_name           return the file name
  *
  *  @version Oyranos: 0.9.7
- *  @date    2018/03/02
+ *  @date    2026/10/17
  *  @since   2017/06/05 (Oyranos: 0.9.7)
  */
 oyProfile_s* lcm2AbstractWhitePointBradford (
                                        double            * src_iccXYZ,
                                        double            * illu_iccXYZ,
+                                       int                 grid_size,
                                        uint32_t            icc_profile_flags,
                                        char             ** file_name )
 {
@@ -3407,10 +4767,14 @@ oyProfile_s* lcm2AbstractWhitePointBradford (
     profile_version = 4.3;
 
   error = lcm2CreateAbstractWhitePointProfileBradford( src_iccXYZ, illu_iccXYZ,
-                                                15,
+                                                grid_size,
                                                 profile_version, file_name?0x01:0,
                                                 & my_abstract_file_name,
                                                 &abs );
+  /* keep file names of other grids apart */
+  if(my_abstract_file_name && grid_size != l2cmsWHITE_POINT_LUT_GRID)
+    sprintf( &my_abstract_file_name[strlen(my_abstract_file_name)], " grid %d",
+             grid_size );
   if(file_name)
   {
     *file_name = my_abstract_file_name;
@@ -3456,13 +4820,14 @@ oyProfile_s* lcm2AbstractWhitePointBradford (
  *                                     - "illu_iccXYZ": The option shall be a double[3] array.
  *                                     - "icc_profile_flags"  ::OY_ICC_VERSION_2 and ::OY_ICC_VERSION_4 let select version 2 and 4 profiles separately.
  *                                     This option shall be a integer.
+ *                                     - "grid_points": LUT grid size, integer, default 15
  *  @param[in]     command             "//" OY_TYPE_STD "/create_profile.white_point_adjust.bradford"
  *  @param[out]    result              will contain a oyProfile_s in "icc_profile.create_profile.white_point_adjust.bradford"
  *
  *  This function uses internally lcm2AbstractWhitePoint().
  *
  *  @version Oyranos: 0.9.7
- *  @date    2018/03/02
+ *  @date    2026/10/17
  *  @since   2017/06/05 (Oyranos: 0.9.7)
  */
 int          l2cmsMOptions_Handle4   ( oyOptions_s       * options,
@@ -3487,8 +4852,10 @@ int          l2cmsMOptions_Handle4   ( oyOptions_s       * options,
   }
   else if(oyFilterRegistrationMatch(command,"create_profile.white_point_adjust.bradford.file_name", 0))
   {
-    int32_t icc_profile_flags = 0;
+    int32_t icc_profile_flags = 0,
+            batch = 1;
     oyOptions_FindInt( options, "icc_profile_flags", 0, &icc_profile_flags ); 
+    oyOptions_FindInt( options, "proofing_batch", 0, &batch );
     char * file_name = NULL;
 
     if( oyOptions_FindDouble( options,  "src_iccXYZ", 0, &src_iccXYZ[0] ) == 0 &&
@@ -3497,7 +4864,7 @@ int          l2cmsMOptions_Handle4   ( oyOptions_s       * options,
         oyOptions_FindDouble( options, "illu_iccXYZ", 0, &illu_iccXYZ[0] ) == 0 &&
         oyOptions_FindDouble( options, "illu_iccXYZ", 1, &illu_iccXYZ[1] ) == 0 &&
         oyOptions_FindDouble( options, "illu_iccXYZ", 2, &illu_iccXYZ[2] ) == 0 )
-      lcm2AbstractWhitePointBradford( src_iccXYZ, illu_iccXYZ, icc_profile_flags, &file_name );
+      lcm2AbstractWhitePointBradford( src_iccXYZ, illu_iccXYZ, l2cmsGridPoints( options ), icc_profile_flags, &file_name );
 
     if(file_name)
     {
@@ -3512,8 +4879,10 @@ int          l2cmsMOptions_Handle4   ( oyOptions_s       * options,
   }
   else if(oyFilterRegistrationMatch(command,"create_profile.white_point_adjust.bradford", 0))
   {
-    int32_t icc_profile_flags = 0;
+    int32_t icc_profile_flags = 0,
+            batch = 1;
     oyOptions_FindInt( options, "icc_profile_flags", 0, &icc_profile_flags ); 
+    oyOptions_FindInt( options, "proofing_batch", 0, &batch );
     oyProfile_s * p = NULL;
 
     if( oyOptions_FindDouble( options,  "src_iccXYZ", 0, &src_iccXYZ[0] ) == 0 &&
@@ -3522,7 +4891,7 @@ int          l2cmsMOptions_Handle4   ( oyOptions_s       * options,
         oyOptions_FindDouble( options, "illu_iccXYZ", 0, &illu_iccXYZ[0] ) == 0 &&
         oyOptions_FindDouble( options, "illu_iccXYZ", 1, &illu_iccXYZ[1] ) == 0 &&
         oyOptions_FindDouble( options, "illu_iccXYZ", 2, &illu_iccXYZ[2] ) == 0 )
-      p = lcm2AbstractWhitePointBradford( src_iccXYZ, illu_iccXYZ, icc_profile_flags, NULL );
+      p = lcm2AbstractWhitePointBradford( src_iccXYZ, illu_iccXYZ, l2cmsGridPoints( options ), icc_profile_flags, NULL );
 
     if(p)
     {
@@ -3566,7 +4935,7 @@ const char * l2cmsInfoGetTextProfile4(const char        * select,
     else if(type == oyNAME_NAME)
       return _("Create a ICC white point profile.");
     else
-      return _("The littleCMS \"create_profile.white_point_adjust.bradford\" command lets you create ICC abstract profiles from CIE*XYZ coordinates for white point adjustment. The filter expects a oyOption_s object with name \"src_iccXYZ\" and \"illu_iccXYZ\" each containing a double triple value in range 0.0 - 2.0. The result will appear in \"icc_profile\" with the additional attributes \"create_profile.white_point_adjust.bradford\" as a oyProfile_s object.");
+      return _("The littleCMS \"create_profile.white_point_adjust.bradford\" command lets you create ICC abstract profiles from CIE*XYZ coordinates for white point adjustment. The filter expects a oyOption_s object with name \"src_iccXYZ\" and \"illu_iccXYZ\" each containing a double triple value in range 0.0 - 2.0. The optional integer \"grid_points\" selects the LUT size, default 15. The result will appear in \"icc_profile\" with the additional attributes \"create_profile.white_point_adjust.bradford\" as a oyProfile_s object.");
   } else if(strcmp(select, "help")==0)
   {
          if(type == oyNAME_NICK)
@@ -3627,14 +4996,16 @@ oyCMMapi10_s_    l2cms_api10_cmm4 = {
  *
  *  @param         cie_a               the white point coordinate
  *  @param         cie_b               the white point coordinate
+ *  @param         grid_size           the LUT grid points per channel
  *  @param         icc_profile_flags   profile flags
  *
  *  @version Oyranos: 0.9.7
  *  @since   2017/06/05 (Oyranos: 0.9.7)
- *  @date    2018/01/17
+ *  @date    2026/10/17
  */
 oyProfile_s* lcm2AbstractWhitePoint  ( double              cie_a,
                                        double              cie_b,
+                                       int                 grid_size,
                                        uint32_t            icc_profile_flags )
 {
   int error = 0;
@@ -3649,7 +5020,7 @@ oyProfile_s* lcm2AbstractWhitePoint  ( double              cie_a,
   if(icc_profile_flags & OY_ICC_VERSION_2)
     profile_version = 4.3;
 
-  error = lcm2CreateAbstractWhitePointProfileLab( cie_a, cie_b, 15,
+  error = lcm2CreateAbstractWhitePointProfileLab( cie_a, cie_b, grid_size,
                                                   profile_version,
                                                   &my_abstract_file_name,
                                                   &abs );
@@ -3693,6 +5064,7 @@ oyProfile_s* lcm2AbstractWhitePoint  ( double              cie_a,
  *                                     - "cie_b": The option shall be a double.
  *                                     - "icc_profile_flags"  ::OY_ICC_VERSION_2 and ::OY_ICC_VERSION_4 let select version 2 and 4 profiles separately.
  *                                     This option shall be a integer.
+ *                                     - "grid_points": LUT grid size, integer, default 15
  *  @param[in]     command             "//" OY_TYPE_STD "/create_profile.white_point_adjust.lab"
  *  @param[out]    result              will contain a oyProfile_s in "icc_profile.create_profile.white_point_adjust.lab"
  *
@@ -3723,13 +5095,15 @@ int          l2cmsMOptions_Handle3   ( oyOptions_s       * options,
   }
   else if(oyFilterRegistrationMatch(command,"create_profile.white_point_adjust.lab", 0))
   {
-    int32_t icc_profile_flags = 0;
+    int32_t icc_profile_flags = 0,
+            batch = 1;
     oyOptions_FindInt( options, "icc_profile_flags", 0, &icc_profile_flags ); 
+    oyOptions_FindInt( options, "proofing_batch", 0, &batch );
     oyProfile_s * p = NULL;
 
     if( oyOptions_FindDouble( options, "cie_a", 0, &cie_a ) == 0 &&
         oyOptions_FindDouble( options, "cie_b", 0, &cie_b ) == 0 )
-      p = lcm2AbstractWhitePoint( cie_a, cie_b, icc_profile_flags );
+      p = lcm2AbstractWhitePoint( cie_a, cie_b, l2cmsGridPoints( options ), icc_profile_flags );
 
     if(p)
     {
@@ -3772,7 +5146,7 @@ const char * l2cmsInfoGetTextProfileC3(const char        * select,
     else if(type == oyNAME_NAME)
       return _("Create a ICC white point profile.");
     else
-      return _("The littleCMS \"create_profile.white_point_adjust.lab\" command lets you create ICC abstract profiles from CIE*ab coordinates for white point adjustment. The filter expects a oyOption_s object with name \"cie_a\" and \"cie_b\" each containing a double value in range -0.5 - 0.5. The result will appear in \"icc_profile\" with the additional attributes \"create_profile.white_point_adjust.lab\" as a oyProfile_s object.");
+      return _("The littleCMS \"create_profile.white_point_adjust.lab\" command lets you create ICC abstract profiles from CIE*ab coordinates for white point adjustment. The filter expects a oyOption_s object with name \"cie_a\" and \"cie_b\" each containing a double value in range -0.5 - 0.5. The optional integer \"grid_points\" selects the LUT size, default 15. The result will appear in \"icc_profile\" with the additional attributes \"create_profile.white_point_adjust.lab\" as a oyProfile_s object.");
   } else if(strcmp(select, "help")==0)
   {
          if(type == oyNAME_NICK)
@@ -3824,6 +5198,95 @@ oyCMMapi10_s_    l2cms_api10_cmm3 = {
 
 /* OY_LCM2_CREATE_ABSTRACT_PROOFING_REGISTRATION -------------------------- */
 
+/* the proofing results of all grid points, see l2cmsProofGridFill_() */
+typedef struct {
+  cmsHTRANSFORM tr;                    /* Lab -> proof -> Lab */
+  int gamut_warning;                   /* gray out of gamut colors */
+  int grid_size;
+  double * table;                      /* grid_size^3 x 3 */
+} l2cmsProofGrid_s;
+
+/* Evaluate lcm2SamplerProof() for all grid points of the abstract profile.
+ * One call to l2cmsDoTransform() converts a row along the last channel and
+ * the rows are spread over threads. */
+static int   l2cmsProofGridFill_     ( l2cmsProofGrid_s  * grid )
+{
+  int n = grid->grid_size, rows = n * n, r, fails = 0;
+
+#pragma omp parallel for reduction(+:fails)
+  for(r = 0; r < rows; ++r)
+  {
+    cmsFloat32Number * i_ = malloc( n * 3 * sizeof(cmsFloat32Number) ),
+                     * o_ = malloc( n * 3 * sizeof(cmsFloat32Number) );
+    double i[3], * o;
+    cmsCIELab Lab1, Lab2;
+    double d;
+    int k;
+
+    if(!i_ || !o_)
+    {
+      ++fails;
+      if(i_) free( i_ );
+      if(o_) free( o_ );
+      continue;
+    }
+
+    i[0] = lcm2GridNode_( r / n, n );
+    i[1] = lcm2GridNode_( r % n, n );
+    for(k = 0; k < n; ++k)
+    {
+      i[2] = lcm2GridNode_( k, n );
+      i_[k*3+0] = i[0] * 100.0;
+      i_[k*3+1] = i[1] * 257.0 - 128.0;
+      i_[k*3+2] = i[2] * 257.0 - 128.0;
+    }
+
+    l2cmsDoTransform( grid->tr, i_, o_, n );
+
+    /* same arithmetic as lcm2SamplerProof() */
+    for(k = 0; k < n; ++k)
+    {
+      i[2] = lcm2GridNode_( k, n );
+      Lab1.L = i[0] * 100.0;
+      Lab1.a = i[1] * 257.0 - 128.0;
+      Lab1.b = i[2] * 257.0 - 128.0;
+      Lab2.L = o_[k*3+0]; Lab2.a = o_[k*3+1]; Lab2.b = o_[k*3+2];
+
+      d = l2cmsDeltaE( &Lab1, &Lab2 );
+      if((fabs(d) > 10) && grid->gamut_warning)
+      {
+        Lab2.L = 50.0;
+        Lab2.a = Lab2.b = 0.0;
+      }
+
+      o = &grid->table[(r * n + k) * 3];
+      o[0] = Lab2.L/100.0;
+      o[1] = (Lab2.a + 128.0) / 257.0;
+      o[2] = (Lab2.b + 128.0) / 257.0;
+    }
+
+    free( i_ );
+    free( o_ );
+  }
+
+  return fails;
+}
+
+/* lcm2Sampler_f reading the l2cmsProofGridFill_() results */
+static void  l2cmsSamplerProofGrid_  ( const double        i[],
+                                             double        o[],
+                                       void              * data )
+{
+  l2cmsProofGrid_s * grid = (l2cmsProofGrid_s*) data;
+  int n = grid->grid_size, pos = 0, c;
+
+  for(c = 0; c < 3; ++c)
+    pos = pos * n + (int)floor( i[c] * (n - 1) + 0.5 );
+
+  for(c = 0; c < 3; ++c)
+    o[c] = grid->table[pos * 3 + c];
+}
+
 /** Function l2cmsGamutCheckAbstract
  *  @brief   convert a proofing profile into a abstract one
  *
@@ -3835,30 +5298,32 @@ oyCMMapi10_s_    l2cms_api10_cmm3 = {
  *  @param         intent              rendering intent
  *  @param         intent_proof        proof rendering intent
  *  @param         icc_profile_flags   profile flags
+ *  @param         batch               1 - convert the grid in rows;
+ *                                     0 - each grid point through
+ *                                     lcm2SamplerProof()
  *
- *  @version Oyranos: 0.1.11
+ *  The proofing transform converts the grid in rows and in parallel,
+ *  before the abstract profile is sampled from the results.
+ *
+ *  @version Oyranos: 0.9.7
  *  @since   2009/11/04 (Oyranos: 0.1.10)
- *  @date    2010/08/14
+ *  @date    2026/10/17
  */
 cmsHPROFILE  l2cmsGamutCheckAbstract  ( oyProfile_s       * proof,
                                        cmsUInt32Number     flags,
                                        int                 intent,
                                        int                 intent_proof,
-                                       uint32_t            icc_profile_flags )
+                                       uint32_t            icc_profile_flags,
+                                       int                 batch )
 {
       int error = 0;
-#if LCMS_VERSION >= 2060
-      cmsContext tc = l2cmsCreateContext( NULL, NULL ); /* threading context */
-      l2cmsSetLogErrorHandlerTHR( tc, l2cmsErrorHandlerFunction );
-#else
-      void * tc = NULL;
-#endif
+      cmsContext tc = l2cmsThreadContext_();
       cmsHPROFILE gmt = 0,
                   hLab = 0,
                   hproof = 0;
       cmsHTRANSFORM tr = 0;
 
-      cmsHTRANSFORM ptr[2] = {0,0};
+      l2cmsProofGrid_s grid = {0,0,l2cmsPROOF_LUT_GRID_RASTER,0};
 
       l2cms_msg( oyMSG_DBG, (oyStruct_s*)proof, OY_DBG_FORMAT_
                 "softproofing %d gamutcheck %d intent %d intent_proof %d", OY_DBG_ARGS_,
@@ -3899,8 +5364,17 @@ cmsHPROFILE  l2cmsGamutCheckAbstract  ( oyProfile_s       * proof,
       if(!tr) { l2cms_msg( oyMSG_ERROR, (oyStruct_s*)proof, OY_DBG_FORMAT_
                           "cmsCreateProofingTransform() failed", OY_DBG_ARGS_);
                 error = 1; }
-      ptr[0] = tr;
-      ptr[1] = flags & cmsFLAGS_GAMUTCHECK ? (oyPointer)1 : 0;
+      grid.tr = tr;
+      grid.gamut_warning = flags & cmsFLAGS_GAMUTCHECK ? 1 : 0;
+      if(!error && batch)
+      {
+        grid.table = malloc( sizeof(double) * 3 * grid.grid_size *
+                             grid.grid_size * grid.grid_size );
+        if(!grid.table || l2cmsProofGridFill_( &grid ))
+        { l2cms_msg( oyMSG_ERROR, (oyStruct_s*)proof, OY_DBG_FORMAT_
+                    "proofing grid failed", OY_DBG_ARGS_);
+          error = 1; }
+      }
       if(!error)
       {
         const char * proof_meta[] = {
@@ -3915,10 +5389,12 @@ cmsHPROFILE  l2cmsGamutCheckAbstract  ( oyProfile_s       * proof,
         0,0
         };
         const char * desc = oyProfile_GetText( proof, oyNAME_DESCRIPTION );
+        void * ptr[2] = { tr, grid.gamut_warning ? (void*)1 : NULL };
         lcm2CreateAbstractProfile (
-                             lcm2SamplerProof, ptr,
+                             batch ? l2cmsSamplerProofGrid_ : lcm2SamplerProof,
+                             batch ? (void*)&grid : (void*)ptr,
                              "*lab", // CIE*Lab
-                             l2cmsPROOF_LUT_GRID_RASTER,
+                             grid.grid_size,
                              icc_profile_flags & OY_ICC_VERSION_2 ? 2.4 : 4.2,
                              "proofing",
                              NULL,
@@ -3953,6 +5429,7 @@ cmsHPROFILE  l2cmsGamutCheckAbstract  ( oyProfile_s       * proof,
   clean:
       if(hLab) { l2cmsCloseProfile( hLab ); hLab = 0; }
       if(tr) { l2cmsDeleteTransform( tr ); tr = 0; }
+      if(grid.table) { free( grid.table ); grid.table = 0; }
 
   return gmt;
 }
@@ -3964,6 +5441,8 @@ cmsHPROFILE  l2cmsGamutCheckAbstract  ( oyProfile_s       * proof,
  *                                     - "proofing_profile": The option shall be a oyProfile_s.
  *                                     - "icc_profile_flags"  ::OY_ICC_VERSION_2 and ::OY_ICC_VERSION_4 let select version 2 and 4 profiles separately.
  *                                     This option shall be a integer.
+ *                                     - "proofing_batch": 0 samples each grid point through lcm2SamplerProof() as reference; default 1 converts the grid in rows.
+ *                                     This option shall be a integer.
  *  @param[in]     command             "//" OY_TYPE_STD "/create_profile.proofing_profile"
  *  @param[out]    result              will contain a oyProfile_s in "icc_profile.create_profile.proofing_profile"
  *
@@ -4001,8 +5480,10 @@ int          l2cmsMOptions_Handle2    ( oyOptions_s       * options,
   }
   else if(oyFilterRegistrationMatch(command,"create_profile", 0))
   {
-    int32_t icc_profile_flags = 0;
+    int32_t icc_profile_flags = 0,
+            batch = 1;
     oyOptions_FindInt( options, "icc_profile_flags", 0, &icc_profile_flags ); 
+    oyOptions_FindInt( options, "proofing_batch", 0, &batch );
 
     p = (oyProfile_s*) oyOptions_GetType( options,-1, "proofing_profile",
                                           oyOBJECT_PROFILE_S );
@@ -4014,7 +5495,8 @@ int          l2cmsMOptions_Handle2    ( oyOptions_s       * options,
       oyOption_s * o;
 
       l2cmsProfileWrap_s * wrap = l2cmsAddProofProfile( p, flags | cmsFLAGS_SOFTPROOFING,
-                                            intent, intent_proof, icc_profile_flags );
+                                            intent, intent_proof, icc_profile_flags,
+                                            batch );
       oyProfile_Release( &p );
 
       prof = oyProfile_FromMem( wrap->size, wrap->block, 0, 0 );
@@ -4059,7 +5541,7 @@ const char * l2cmsInfoGetTextProfileC2(const char        * select,
     else if(type == oyNAME_NAME)
       return _("Create a ICC abstract proofing profile.");
     else
-      return _("The littleCMS \"create_profile.proofing_effect\" command lets you create ICC abstract profiles from a given ICC profile for proofing. The filter expects a oyOption_s object with name \"proofing_profile\" containing a oyProfile_s as value. The options \"rendering_intent\", \"rendering_intent_proof\", \"rendering_bpc\", \"rendering_gamut_warning\", \"precalculation\", \"precalculation_curves\", \"cmyk_cmyk_black_preservation\", \"adaption_state\"  and \"no_white_on_white_fixup\" are honoured. The result will appear in \"icc_profile\" with the additional attributes \"create_profile.proofing_effect\" as a oyProfile_s object.");
+      return _("The littleCMS \"create_profile.proofing_effect\" command lets you create ICC abstract profiles from a given ICC profile for proofing. The filter expects a oyOption_s object with name \"proofing_profile\" containing a oyProfile_s as value. The options \"rendering_intent\", \"rendering_intent_proof\", \"rendering_bpc\", \"rendering_gamut_warning\", \"precalculation\", \"precalculation_curves\", \"cmyk_cmyk_black_preservation\", \"adaption_state\"  and \"no_white_on_white_fixup\" are honoured. The integer option \"proofing_batch\" set to 0 samples each grid point separately, as reference for the default batched grid. The result will appear in \"icc_profile\" with the additional attributes \"create_profile.proofing_effect\" as a oyProfile_s object.");
   } else if(strcmp(select, "help")==0)
   {
          if(type == oyNAME_NICK)
@@ -4513,7 +5995,7 @@ oyCMMapi4_s_ l2cms_api4_cmm = {
   l2cmsCMMMessageFuncSet,
 
   OY_TOP_SHARED OY_SLASH OY_DOMAIN_INTERNAL OY_SLASH OY_TYPE_STD OY_SLASH
-  "icc_color._" CMM_NICK "._icc_version_2._icc_version_4._CPU._NOACCEL._effect",
+  "icc_color._" CMM_NICK "._icc_version_2._icc_version_4._CPU._NOACCEL._effect._chain._pointwise",
 
   CMM_VERSION,
   CMM_API_VERSION,                  /**< int32_t module_api[3] */
@@ -4574,7 +6056,7 @@ const char * l2cmsInfoGetText         ( const char        * select,
     else if(type == oyNAME_NAME)
       return _("The lcms \"color_icc\" filter is a one dimensional color conversion filter. It can both create a color conversion context, some precalculated for processing speed up, and the color conversion with the help of that context. The adaption part of this filter transforms the Oyranos color context, which is ICC device link based, to the internal lcms format.");
     else
-      return _("The following options are available to create color contexts:\n \"profiles_simulation\", a option of type oyProfiles_s, can contain device profiles for proofing.\n \"profiles_effect\", a option of type oyProfiles_s, can contain abstract color profiles.\n The following Oyranos options are supported: \"rendering_gamut_warning\", \"rendering_intent_proof\", \"rendering_bpc\", \"rendering_intent\", \"proof_soft\" and \"proof_hard\".\n The additional lcms option is supported \"cmyk_cmyk_black_preservation\" [0 - none; 1 - LCMS_PRESERVE_PURE_K; 2 - LCMS_PRESERVE_K_PLANE], \"precalculation\": [0 - normal; 1 - cmsFLAGS_NOOPTIMIZE; 2 - cmsFLAGS_HIGHRESPRECALC, 3 - cmsFLAGS_LOWRESPRECALC], \"precalculation_curves\": [0 - none; 1 - cmsFLAGS_CLUT_POST_LINEARIZATION + cmsFLAGS_CLUT_PRE_LINEARIZATION], \"adaption_state\": [0.0 - not adapted to screen, 1.0 - full adapted to screen] and \"no_white_on_white_fixup\": [0 - force white on white, 1 - keep as is]." );
+      return _("The following options are available to create color contexts:\n \"profiles_simulation\", a option of type oyProfiles_s, can contain device profiles for proofing.\n \"profiles_effect\", a option of type oyProfiles_s, can contain abstract color profiles.\n The following Oyranos options are supported: \"rendering_gamut_warning\", \"rendering_intent_proof\", \"rendering_bpc\", \"rendering_intent\", \"proof_soft\" and \"proof_hard\".\n The additional lcms option is supported \"cmyk_cmyk_black_preservation\" [0 - none; 1 - LCMS_PRESERVE_PURE_K; 2 - LCMS_PRESERVE_K_PLANE], \"precalculation\": [0 - normal; 1 - cmsFLAGS_NOOPTIMIZE; 2 - cmsFLAGS_HIGHRESPRECALC, 3 - cmsFLAGS_LOWRESPRECALC, 4 - native 3D LUT for 8-bit RGB(A)], \"precalculation_curves\": [0 - none; 1 - cmsFLAGS_CLUT_POST_LINEARIZATION + cmsFLAGS_CLUT_PRE_LINEARIZATION], \"adaption_state\": [0.0 - not adapted to screen, 1.0 - full adapted to screen] and \"no_white_on_white_fixup\": [0 - force white on white, 1 - keep as is]." );
   }
   return 0;
 }
@@ -865,6 +865,208 @@ void     oiccFilterNode_OptionsPrint ( oyFilterNode_s    * node,
               }
 }
 
+/** @internal
+ *  Options of a ICC node as text, to compare nodes for merging.
+ *  Intermediate profiles from earlier merges are skipped. */
+static char *    oiccFilterNode_MergeText_(
+                                       oyFilterNode_s    * node )
+{
+  oyOptions_s * opts = oyFilterNode_GetOptions( node, 0 );
+  oyOption_s * o;
+  char * text = NULL,
+       * value;
+  int i, n = oyOptions_Count( opts );
+
+  for(i = 0; i < n; ++i)
+  {
+    o = oyOptions_Get( opts, i );
+    if(!oyFilterRegistrationMatch( oyOption_GetRegistration( o ),
+                                   "profiles_intermediate", 0 ))
+    {
+      value = oyOption_GetValueText( o, oyAllocateFunc_ );
+      oyStringAddPrintf( &text, oyAllocateFunc_, oyDeAllocateFunc_,
+                         "%s:%s\n", oyOption_GetRegistration( o ),
+                         value ? value : "" );
+      if(value) oyFree_m_( value );
+    }
+    oyOption_Release( &o );
+  }
+
+  if(!text)
+    text = oyStringCopy( "", oyAllocateFunc_ );
+
+  oyOptions_Release( &opts );
+
+  return text;
+}
+
+/** @internal
+ *  Check if the ICC node and its preceding node can become one transform.
+ *  Both have to use the same module, which needs to understand
+ *  "profiles_intermediate". Effect and proofing profiles are kept apart. */
+static int       oiccFilterNode_CanMerge_(
+                                       oyFilterNode_s    * node,
+                                       oyFilterNode_s    * prev )
+{
+  const char * reg = oyFilterNode_GetRegistration( node ),
+             * reg_prev = oyFilterNode_GetRegistration( prev );
+  oyOptions_s * opts = NULL;
+  char * text = NULL,
+       * text_prev = NULL;
+  int can = 0, i;
+
+  if(!reg || !reg_prev || strcmp( reg, reg_prev ) != 0 ||
+     !oyFilterRegistrationMatch( reg, "//" OY_TYPE_STD "/icc_color.+chain", 0 ))
+    return 0;
+
+  /* the previous node output must only feed this node */
+  if(oyFilterNode_CountSocketNodes( prev, 0, OY_FILTEREDGE_CONNECTED ) != 1 ||
+     oyFilterNode_EdgeCount( prev, 1, OY_FILTEREDGE_CONNECTED ) != 1)
+    return 0;
+
+  can = 1;
+  for(i = 0; i < 2 && can; ++i)
+  {
+    opts = oyFilterNode_GetOptions( i ? prev : node, 0 );
+    if(oyOptions_FindString( opts, "proof_soft", "1" ) ||
+       oyOptions_FindString( opts, "proof_hard", "1" ) ||
+       oyOptions_FindString( opts, "effect_switch", "1" ) ||
+       oyOptions_FindString( opts, "rendering_gamut_warning", "1" ) ||
+       oyOptions_CountType( opts, "display.abstract.icc_profile",
+                            oyOBJECT_PROFILE_S ))
+      can = 0;
+    oyOptions_Release( &opts );
+  }
+
+  if(can)
+  {
+    text = oiccFilterNode_MergeText_( node );
+    text_prev = oiccFilterNode_MergeText_( prev );
+    can = strcmp( text, text_prev ) == 0;
+    oyFree_m_( text );
+    oyFree_m_( text_prev );
+  }
+
+  return can;
+}
+
+/** @internal
+ *  Remove the node before node and let node convert its input directly.
+ *  The colour space in between is kept as intermediate profile. */
+static int       oiccFilterNode_Merge_(oyFilterNode_s    * node,
+                                       oyFilterNode_s    * prev,
+                                       int                 verbose )
+{
+  int error = 0, i, k, n;
+  oyFilterPlug_s * prev_plug = oyFilterNode_GetPlug( prev, 0 );
+  oyFilterSocket_s * src_socket = oyFilterPlug_GetSocket( prev_plug ),
+                   * socket0 = NULL;
+  oyFilterNode_s * src = oyFilterSocket_GetNode( src_socket );
+  oyImage_s * image = (oyImage_s*) oyFilterNode_GetData( prev, 0 );
+  oyProfile_s * p = oyImage_GetProfile( image );
+  oyOptions_s * opts = NULL;
+  oyOption_s * o;
+  oyProfiles_s * chain = NULL,
+               * list;
+
+  socket0 = oyFilterNode_GetSocket( src, 0 );
+  if(!src || !p || socket0 != src_socket)
+    error = 1;
+  oyFilterSocket_Release( &socket0 );
+
+  if(!error)
+  {
+    chain = oyProfiles_New( 0 );
+    for(i = 0; i < 2; ++i)
+    {
+      /* keep the order: previous intermediates, the joint, own ones */
+      opts = oyFilterNode_GetOptions( i ? node : prev, 0 );
+      o = oyOptions_Find( opts, "profiles_intermediate", oyNAME_PATTERN );
+      list = (oyProfiles_s*) oyOption_GetStruct( o, oyOBJECT_PROFILES_S );
+      n = oyProfiles_Count( list );
+      for(k = 0; k < n; ++k)
+      {
+        oyProfile_s * ip = oyProfiles_Get( list, k );
+        oyProfiles_MoveIn( chain, &ip, -1 );
+      }
+      oyProfiles_Release( &list );
+      oyOption_Release( &o );
+      if(i == 0)
+        oyProfiles_MoveIn( chain, &p, -1 );
+      else
+        error = oyOptions_MoveInStruct( &opts, OY_PROFILES_INTERMEDIATE,
+                                        (oyStruct_s**) &chain, OY_CREATE_NEW );
+      oyOptions_Release( &opts );
+    }
+  }
+
+  if(!error)
+  {
+    if(verbose)
+      oicc_msg( oyMSG_DBG, (oyStruct_s*)node, OY_DBG_FORMAT_
+                "merge node[%d] into node[%d]", OY_DBG_ARGS_,
+                oyFilterNode_GetId( prev ), oyFilterNode_GetId( node ) );
+    /* detach prev from the source first; reconnecting restores the source */
+    oyFilterNode_Disconnect( prev, 0 );
+    error = oyFilterNode_Connect( src, NULL, node, NULL, 0 );
+  }
+
+  if(!error)
+  {
+    /* the conversion releases only nodes in its graph; drop its reference */
+    oyFilterNode_s * owned = prev;
+    oyFilterNode_Release( &owned );
+  }
+
+  oyProfiles_Release( &chain );
+  oyProfile_Release( &p );
+  oyImage_Release( &image );
+  oyFilterNode_Release( &src );
+  oyFilterSocket_Release( &src_socket );
+  oyFilterPlug_Release( &prev_plug );
+
+  return error;
+}
+
+/** @internal
+ *  Collapse chains of ICC nodes into the last node of each chain. A chain like
+ *  input->working space->display then runs as one multi profile transform
+ *  without a intermediate image. */
+static int   oiccConversion_MergeIccNodes_(
+                                       oyConversion_s    * conversion,
+                                       int                 verbose )
+{
+  int error = 0, merged, i, n;
+  oyFilterGraph_s * g;
+  oyFilterNode_s * node, * prev;
+
+  do
+  {
+    merged = 0;
+    node = oyConversion_GetNode( conversion, OY_INPUT );
+    g = oyFilterGraph_FromNode( node, 0 );
+    oyFilterNode_Release( &node );
+
+    n = oyFilterGraph_CountNodes( g, "//" OY_TYPE_STD "/icc_color", NULL );
+    for(i = 0; i < n && !merged && !error; ++i)
+    {
+      node = oyFilterGraph_GetNode( g, i, "//" OY_TYPE_STD "/icc_color", NULL );
+      prev = oyFilterNode_EdgeCount( node, 1, OY_FILTEREDGE_CONNECTED ) == 1 ?
+             oyFilterNode_GetPlugNode( node, 0 ) : NULL;
+      if(prev && oiccFilterNode_CanMerge_( node, prev ))
+      {
+        error = oiccFilterNode_Merge_( node, prev, verbose );
+        merged = !error;
+      }
+      oyFilterNode_Release( &prev );
+      oyFilterNode_Release( &node );
+    }
+    oyFilterGraph_Release( &g );
+  } while(merged);
+
+  return error;
+}
+
 int           oiccConversion_Correct ( oyConversion_s    * conversion,
                                        uint32_t            flags,
                                        oyOptions_s       * options )
@@ -904,6 +1106,9 @@ int           oiccConversion_Correct ( oyConversion_s    * conversion,
               oyOptions_FindString( options, "display_mode", 0):"");
 
 
+  /* one multi profile transform instead of a ICC node chain */
+  error = oiccConversion_MergeIccNodes_( s, verbose );
+
   node = oyConversion_GetNode( s, OY_INPUT );
   if(!node)
     node = oyConversion_GetNode( s, OY_OUTPUT );
@@ -177,6 +177,11 @@ int  oyraInit                        ( oyStruct_s        * module_info OY_UNUSED
   m = oyraApi7ImageScaleCreate();
   oyCMMapi_SetNext( a, m ); a = m;
 
+  m = oyraApi4ImageClutCreate();
+  oyCMMapi_SetNext( a, m ); a = m;
+  m = oyraApi7ImageClutCreate();
+  oyCMMapi_SetNext( a, m ); a = m;
+
   return 0;
 }
 
@@ -18,6 +18,7 @@
 
 #include "oyCMMapi4_s_.h"
 #include "oyCMMapi7_s_.h"
+#include "oyCMMapi9_s_.h"
 #include "oyCMMapi10_s_.h"
 
 #include "oyranos_config_internal.h"
@@ -90,6 +91,9 @@ oyCMMapi_s * oyraApi4ImageChannelCreate(void);
 oyCMMapi_s * oyraApi7ImageChannelCreate(void);
 oyCMMapi_s * oyraApi4ImageExposeCreate(void);
 oyCMMapi_s * oyraApi7ImageExposeCreate(void);
+oyCMMapi_s * oyraApi4ImageClutCreate(void);
+oyCMMapi_s * oyraApi7ImageClutCreate(void);
+extern oyCMMapi9_s_   oyra_api9_bake;
 extern oyCMMapi10_s_  oyra_api10_profile_graph2d_SaturationLine;
 
 #endif /* OYRANOS_CMM_OYRA_H */
@@ -0,0 +1,929 @@
+/** @file oyranos_cmm_oyra_image_clut.c
+ *
+ *  Oyranos is an open source Color Management System
+ *
+ *  @par Copyright:
+ *            2026 (C) Kai-Uwe Behrmann
+ *
+ *  @brief    3D CLUT module for Oyranos
+ *  @internal
+ *  @author   Kai-Uwe Behrmann <ku.b@gmx.de>
+ *  @par License:
+ *            new BSD <http://www.opensource.org/licenses/BSD-3-Clause>
+ *  @since    2026/10/17
+ */
+
+#include "oyArray2d_s.h"
+#include "oyCMMapi4_s.h"
+#include "oyCMMapi7_s.h"
+#include "oyCMMapi9_s_.h"
+#include "oyCMMui_s.h"
+#include "oyConnectorImaging_s.h"
+#include "oyConversion_s.h"
+#include "oyFilterNodes_s.h"
+#include "oyPixelAccess_s.h"
+
+#include "oyranos_cmm.h"
+#include "oyranos_cmm_oyra.h"
+#include "oyranos_helper.h"
+#include "oyranos_i18n.h"
+#include "oyranos_string.h"
+
+#include <math.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#ifdef HAVE_POSIX
+#include <stdint.h>  /* UINT32_MAX */
+#endif
+#if defined(__SSE__)
+#include <xmmintrin.h>
+#endif
+
+/* OY_IMAGE_CLUT_REGISTRATION */
+/* OY_BAKE_REGISTRATION */
+
+
+
+/* OY_IMAGE_CLUT_REGISTRATION ------------------------------------------------*/
+
+/** default grid points per channel for baking */
+#define oyraCLUT_GRID 33
+
+typedef struct oyraClut_s_ oyraClut_s;
+typedef void (*oyraClutRun_f)        ( const oyraClut_s  * clut,
+                                       const float       * in,
+                                       float             * out,
+                                       int                 n );
+/** @struct  oyraClut_s
+ *  @brief   3D CLUT with float nodes
+ *
+ *  The nodes are padded to four floats for up to four output channels, so
+ *  one SIMD register holds a node.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/17
+ *  @since   2026/10/17 (Oyranos: 0.9.7)
+ */
+struct oyraClut_s_ {
+  const float * nodes;                 /**< grid^3 nodes, first channel slowest */
+  int           grid;                  /**< grid points per channel */
+  int           stride;                /**< floats per node */
+  int           channels;              /**< output channels */
+  oyraClutRun_f run;                   /**< selected kernel */
+};
+
+/* select the tetrahedron around pixel and its four weights summing to 1 */
+static void    oyraClutCell_         ( const oyraClut_s  * clut,
+                                       const float       * pixel,
+                                       const float      ** c,
+                                       float             * w )
+{
+  const int g1 = clut->grid - 1,
+            Z = clut->stride,
+            Y = clut->grid * Z,
+            X = clut->grid * Y;
+  float fx = pixel[0] * g1,
+        fy = pixel[1] * g1,
+        fz = pixel[2] * g1,
+        rx, ry, rz;
+  int ix = (int)fx,
+      iy = (int)fy,
+      iz = (int)fz,
+      o1, o2;
+
+  /* 1.0 falls into the last cell */
+  if(ix >= g1) ix = g1 - 1;
+  if(iy >= g1) iy = g1 - 1;
+  if(iz >= g1) iz = g1 - 1;
+  rx = fx - ix;
+  ry = fy - iy;
+  rz = fz - iz;
+
+  if(rx >= ry)
+  {
+    if(ry >= rz)
+    { o1 = X; o2 = X+Y; w[0] = 1.f-rx; w[1] = rx-ry; w[2] = ry-rz; w[3] = rz;
+    } else if(rx >= rz)
+    { o1 = X; o2 = X+Z; w[0] = 1.f-rx; w[1] = rx-rz; w[2] = rz-ry; w[3] = ry;
+    } else
+    { o1 = Z; o2 = X+Z; w[0] = 1.f-rz; w[1] = rz-rx; w[2] = rx-ry; w[3] = ry;
+    }
+  } else
+  {
+    if(rz >= ry)
+    { o1 = Z; o2 = Y+Z; w[0] = 1.f-rz; w[1] = rz-ry; w[2] = ry-rx; w[3] = rx;
+    } else if(rz >= rx)
+    { o1 = Y; o2 = Y+Z; w[0] = 1.f-ry; w[1] = ry-rz; w[2] = rz-rx; w[3] = rx;
+    } else
+    { o1 = Y; o2 = X+Y; w[0] = 1.f-ry; w[1] = ry-rx; w[2] = rx-rz; w[3] = rz;
+    }
+  }
+
+  c[0] = clut->nodes + ix*X + iy*Y + iz*Z;
+  c[1] = c[0] + o1;
+  c[2] = c[0] + o2;
+  c[3] = c[0] + X+Y+Z;
+}
+
+/* portable kernel; the SIMD kernel sums in the same order */
+static void    oyraClutRunC_         ( const oyraClut_s  * clut,
+                                       const float       * in,
+                                       float             * out,
+                                       int                 n )
+{
+  const int co = clut->channels;
+  const float * c[4];
+  float w[4];
+  int i, j;
+
+  for(i = 0; i < n; ++i)
+  {
+    oyraClutCell_( clut, in, c, w );
+    for(j = 0; j < co; ++j)
+      out[j] = c[0][j]*w[0] + c[1][j]*w[1] + c[2][j]*w[2] + c[3][j]*w[3];
+    in += 3;
+    out += co;
+  }
+}
+
+#if defined(__SSE__)
+/* one node per register; needs the padded four float nodes */
+static void    oyraClutRunSSE_       ( const oyraClut_s  * clut,
+                                       const float       * in,
+                                       float             * out,
+                                       int                 n )
+{
+  const int co = clut->channels;
+  const float * c[4];
+  float w[4], result[4];
+  __m128 v;
+  int i;
+
+  for(i = 0; i < n; ++i)
+  {
+    oyraClutCell_( clut, in, c, w );
+    v = _mm_mul_ps( _mm_loadu_ps( c[0] ), _mm_set1_ps( w[0] ) );
+    v = _mm_add_ps( v, _mm_mul_ps( _mm_loadu_ps( c[1] ), _mm_set1_ps( w[1] ) ) );
+    v = _mm_add_ps( v, _mm_mul_ps( _mm_loadu_ps( c[2] ), _mm_set1_ps( w[2] ) ) );
+    v = _mm_add_ps( v, _mm_mul_ps( _mm_loadu_ps( c[3] ), _mm_set1_ps( w[3] ) ) );
+    _mm_storeu_ps( result, v );
+    memcpy( out, result, co * sizeof(float) );
+    in += 3;
+    out += co;
+  }
+}
+#endif /* __SSE__ */
+
+/** Function oyraClutCanHandle_
+ *  @brief   check a pixel layout for CLUT processing
+ *
+ *  Interleaved native byte order integer and float types qualify.
+ *
+ *  @param[in]     pixel_layout        the image layout
+ *  @param[in]     channels            required channel count or zero
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/17
+ *  @since   2026/10/17 (Oyranos: 0.9.7)
+ */
+static int     oyraClutCanHandle_    ( oyPixel_t           pixel_layout,
+                                       int                 channels )
+{
+  oyDATATYPE_e data_type = oyToDataType_m( pixel_layout );
+
+  return (data_type == oyUINT8 || data_type == oyUINT16 ||
+          data_type == oyFLOAT || data_type == oyDOUBLE) &&
+         oyToChannels_m( pixel_layout ) &&
+         (!channels || (int)oyToChannels_m( pixel_layout ) == channels) &&
+         !oyToPlanar_m( pixel_layout ) &&
+         !oyToByteswap_m( pixel_layout );
+}
+
+/* read samples as 0.0 - 1.0 floats */
+static void    oyraClutLineIn_       ( oyDATATYPE_e        data_type,
+                                       const uint8_t     * src,
+                                       float             * dst,
+                                       int                 n )
+{
+  int i;
+  float v;
+
+  switch(data_type)
+  {
+    case oyUINT8:
+      for(i = 0; i < n; ++i)
+        dst[i] = src[i] / 255.f;
+      break;
+    case oyUINT16:
+      for(i = 0; i < n; ++i)
+        dst[i] = ((const uint16_t*)src)[i] / 65535.f;
+      break;
+    case oyFLOAT:
+      for(i = 0; i < n; ++i)
+      {
+        v = ((const float*)src)[i];
+        dst[i] = v < 0.f ? 0.f : v > 1.f ? 1.f : v;
+      }
+      break;
+    case oyDOUBLE:
+      for(i = 0; i < n; ++i)
+      {
+        v = ((const double*)src)[i];
+        dst[i] = v < 0.f ? 0.f : v > 1.f ? 1.f : v;
+      }
+      break;
+    default: break;
+  }
+}
+
+/* write 0.0 - 1.0 floats as samples; integers are clipped */
+static void    oyraClutLineOut_      ( oyDATATYPE_e        data_type,
+                                       const float       * src,
+                                       uint8_t           * dst,
+                                       int                 n )
+{
+  int i;
+  float v;
+
+  switch(data_type)
+  {
+    case oyUINT8:
+      for(i = 0; i < n; ++i)
+      {
+        v = src[i] * 255.f + .5f;
+        dst[i] = v < 0.f ? 0 : v > 255.f ? 255 : (uint8_t)v;
+      }
+      break;
+    case oyUINT16:
+      for(i = 0; i < n; ++i)
+      {
+        v = src[i] * 65535.f + .5f;
+        ((uint16_t*)dst)[i] = v < 0.f ? 0 : v > 65535.f ? 65535 : (uint16_t)v;
+      }
+      break;
+    case oyFLOAT:
+      memcpy( dst, src, n * sizeof(float) );
+      break;
+    case oyDOUBLE:
+      for(i = 0; i < n; ++i)
+        ((double*)dst)[i] = src[i];
+      break;
+    default: break;
+  }
+}
+
+/** @brief   implement oyCMMFilter_GetNext_f()
+ *
+ *  The node interpolates three channel input pixels tetrahedral inside the
+ *  "clut" option. The "clut" oyArray2d_s holds grid_points^3 float nodes with
+ *  the first channel varying slowest. Nodes are padded to four floats for up
+ *  to four output channels. The "grid_points" option tells the grid size.
+ *  Such nodes are typical created by the "//" OY_TYPE_STD "/bake" policy.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/17
+ *  @since   2026/10/17 (Oyranos: 0.9.7)
+ */
+int      oyraFilter_ImageClutRun     ( oyFilterPlug_s    * requestor_plug,
+                                       oyPixelAccess_s   * ticket )
+{
+  int error = 0, k, n, lines, channels_out;
+  int32_t grid = 0;
+  oyFilterSocket_s * socket = oyFilterPlug_GetSocket( requestor_plug );
+  oyFilterNode_s * node = oyFilterSocket_GetNode( socket ),
+                 * input_node = oyFilterNode_GetPlugNode( node, 0 );
+  oyFilterPlug_s * plug = oyFilterNode_GetPlug( node, 0 );
+  oyOptions_s * node_opts = oyFilterNode_GetOptions( node, 0 );
+  oyOption_s * o = oyOptions_Find( node_opts, "//" OY_TYPE_STD "/clut/clut",
+                                   oyNAME_PATTERN );
+  oyArray2d_s * clut_array = (oyArray2d_s*) oyOption_GetStruct( o, oyOBJECT_ARRAY2D_S );
+  oyImage_s * image_input = oyFilterPlug_ResolveImage( plug, socket, ticket ),
+            * image_output = oyPixelAccess_GetOutputImage( ticket );
+  oyPixel_t layout_in = oyImage_GetPixelLayout( image_input, oyLAYOUT ),
+            layout_out = oyImage_GetPixelLayout( image_output, oyLAYOUT );
+  oyDATATYPE_e data_type_in = oyToDataType_m( layout_in ),
+               data_type_out = oyToDataType_m( layout_out );
+  oyArray2d_s * array_in = NULL,
+              * array_out = NULL;
+  oyPixelAccess_s * new_ticket = ticket;
+  oyraClut_s clut;
+
+  channels_out = oyToChannels_m( layout_out );
+  oyOptions_FindInt( node_opts, "//" OY_TYPE_STD "/clut/grid_points", 0, &grid );
+
+  memset( &clut, 0, sizeof(clut) );
+  if(!clut_array || grid < 2 || !image_input || !image_output ||
+     !oyraClutCanHandle_( layout_in, 3 ) || !oyraClutCanHandle_( layout_out, 0 ))
+  {
+    oyra_msg( oyMSG_WARN, (oyStruct_s*)ticket, OY_DBG_FORMAT_
+              "%s grid: %d %s -> %s", OY_DBG_ARGS_, _("no usable CLUT"), grid,
+              oyNoEmptyString_m_(oyPixelPrint(layout_in,malloc)),
+              oyNoEmptyString_m_(oyPixelPrint(layout_out,malloc)) );
+    error = 1;
+  } else
+  {
+    clut.grid = grid;
+    clut.channels = channels_out;
+    clut.stride = channels_out > 4 ? channels_out : 4;
+    clut.nodes = ((const float**) oyArray2d_GetData( clut_array ))[0];
+    clut.run = oyraClutRunC_;
+#if defined(__SSE__)
+    if(clut.stride == 4)
+      clut.run = oyraClutRunSSE_;
+#endif
+    if(oyArray2d_GetWidth( clut_array ) < (int)(grid * grid * grid * clut.stride))
+      error = 1;
+  }
+
+  if(!error && layout_in != layout_out)
+  {
+    /* create a new ticket to avoid pixel layout conflicts */
+    /* keep old ticket array dimensions */
+    oyArray2d_s * a,
+                * old_a = oyPixelAccess_GetArray( new_ticket );
+    new_ticket = oyPixelAccess_Copy( ticket, ticket->oy_ );
+    oyPixelAccess_SetOutputImage( new_ticket, image_input );
+
+    /* remove old array as it's layout does not fit */
+    oyPixelAccess_SetArray( new_ticket, 0, 0 );
+    {
+      int w = oyArray2d_GetDataGeo1( old_a, 2 ) / channels_out;
+      int h = oyArray2d_GetDataGeo1( old_a, 3 );
+      a = oyArray2d_CreateAligned( w * 3, h, data_type_in, ticket->oy_ );
+    }
+    oyArray2d_Release( &old_a );
+    oyPixelAccess_SetArray( new_ticket, a, 0 );
+    oyArray2d_Release( &a );
+
+    oyPixelAccess_SynchroniseROI( new_ticket, ticket );
+  }
+
+  /* let the input filter do its processing first */
+  if(!error)
+    error = oyFilterNode_Run( input_node, plug, new_ticket );
+
+  if(!error)
+  {
+    array_in = oyPixelAccess_GetArray( new_ticket );
+    array_out = oyPixelAccess_GetArray( ticket );
+    error = !array_in || !array_out;
+  }
+
+  if(!error)
+  {
+    uint8_t ** array_in_data = oyArray2d_GetData( array_in ),
+            ** array_out_data = oyArray2d_GetData( array_out );
+    int threads_n =
+#if defined(_OPENMP) && defined(USE_OPENMP)
+                    omp_get_max_threads();
+#else
+                    1;
+#endif
+    int index = 0, line_size;
+    float * lines_tmp;
+    double trace = oyTraceBegin();
+
+    n = OY_MIN( oyArray2d_GetWidth( array_in ) / 3,
+                oyArray2d_GetWidth( array_out ) / channels_out );
+    lines = OY_MIN( oyArray2d_GetHeight( array_in ),
+                    oyArray2d_GetHeight( array_out ) );
+
+    /* one float line for input and output per thread */
+    line_size = (3 + channels_out) * n;
+    lines_tmp = oyAllocateFunc_( line_size * threads_n * sizeof(float) );
+    error = !lines_tmp;
+
+    if(!error)
+    {
+#if defined(USE_OPENMP)
+#pragma omp parallel for private(k,index)
+#endif
+      for(k = 0; k < lines; ++k)
+      {
+        float * in, * out;
+#if defined(_OPENMP) && defined(USE_OPENMP)
+        index = omp_get_thread_num();
+#endif
+        in = &lines_tmp[line_size * index];
+        out = in + 3 * n;
+        oyraClutLineIn_( data_type_in, array_in_data[k], in, 3 * n );
+        clut.run( &clut, in, out, n );
+        oyraClutLineOut_( data_type_out, out, array_out_data[k], channels_out * n );
+      }
+      oyDeAllocateFunc_( lines_tmp );
+    }
+    if(trace)
+      oyTraceEnd( trace, "oyraClut lines", CMM_NICK, -1 );
+  }
+
+  if(new_ticket != ticket)
+    oyPixelAccess_Release( &new_ticket );
+  oyArray2d_Release( &array_in );
+  oyArray2d_Release( &array_out );
+  oyArray2d_Release( &clut_array );
+  oyOption_Release( &o );
+  oyOptions_Release( &node_opts );
+  oyImage_Release( &image_input );
+  oyImage_Release( &image_output );
+  oyFilterPlug_Release( &plug );
+  oyFilterNode_Release( &input_node );
+  oyFilterNode_Release( &node );
+  oyFilterSocket_Release( &socket );
+
+  return error;
+}
+
+
+#define OY_IMAGE_CLUT_REGISTRATION OY_TOP_SHARED OY_SLASH OY_DOMAIN_INTERNAL OY_SLASH OY_TYPE_STD OY_SLASH "clut._pointwise"
+
+/** @brief    oyra oyCMMapi7_s implementation
+ *
+ *  a filter applying a 3D CLUT
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/17
+ *  @since   2026/10/17 (Oyranos: 0.9.7)
+ */
+oyCMMapi_s * oyraApi7ImageClutCreate(void)
+{
+  oyCMMapi7_s * clut7;
+  int32_t cmm_version[3] = {OYRANOS_VERSION_A,OYRANOS_VERSION_B,OYRANOS_VERSION_C},
+          module_api[3]  = {OYRANOS_VERSION_A,OYRANOS_VERSION_B,OYRANOS_VERSION_C};
+  static oyDATATYPE_e data_types[5] = {oyUINT8, oyUINT16, oyFLOAT, oyDOUBLE, 0};
+  oyConnectorImaging_s * plug = oyConnectorImaging_New(0),
+                       * socket = oyConnectorImaging_New(0);
+  static oyConnectorImaging_s * plugs[2] = {0,0},
+                              * sockets[2] = {0,0};
+  plugs[0] = plug;
+  sockets[0] = socket;
+
+  oyConnectorImaging_SetDataTypes( plug, data_types, 4 );
+  oyConnectorImaging_SetReg( plug, "//" OY_TYPE_STD "/manipulator.data" );
+  oyConnectorImaging_SetMatch( plug, oyFilterSocket_MatchImagingPlug );
+  oyConnectorImaging_SetTexts( plug, oyCMMgetImageConnectorPlugText,
+                               oy_image_connector_texts );
+  oyConnectorImaging_SetIsPlug( plug, 1 );
+  oyConnectorImaging_SetCapability( plug, oyCONNECTOR_IMAGING_CAP_MAX_COLOR_OFFSET, 0 );
+  oyConnectorImaging_SetCapability( plug, oyCONNECTOR_IMAGING_CAP_MIN_CHANNELS_COUNT, 3 );
+  oyConnectorImaging_SetCapability( plug, oyCONNECTOR_IMAGING_CAP_MAX_CHANNELS_COUNT, 3 );
+  oyConnectorImaging_SetCapability( plug, oyCONNECTOR_IMAGING_CAP_MIN_COLOR_COUNT, 1 );
+  oyConnectorImaging_SetCapability( plug, oyCONNECTOR_IMAGING_CAP_MAX_COLOR_COUNT, 3 );
+  oyConnectorImaging_SetCapability( plug, oyCONNECTOR_IMAGING_CAP_CAN_INTERWOVEN, 1 );
+  oyConnectorImaging_SetCapability( plug, oyCONNECTOR_IMAGING_CAP_ID, 1 );
+
+  oyConnectorImaging_SetDataTypes( socket, data_types, 4 );
+  oyConnectorImaging_SetReg( socket, "//" OY_TYPE_STD "/manipulator.data" );
+  oyConnectorImaging_SetMatch( socket, oyFilterSocket_MatchImagingPlug );
+  oyConnectorImaging_SetTexts( socket, oyCMMgetImageConnectorSocketText,
+                               oy_image_connector_texts );
+  oyConnectorImaging_SetIsPlug( socket, 0 );
+  oyConnectorImaging_SetCapability( socket, oyCONNECTOR_IMAGING_CAP_MAX_COLOR_OFFSET, -1 );
+  oyConnectorImaging_SetCapability( socket, oyCONNECTOR_IMAGING_CAP_MIN_CHANNELS_COUNT, 1 );
+  oyConnectorImaging_SetCapability( socket, oyCONNECTOR_IMAGING_CAP_MAX_CHANNELS_COUNT, 255 );
+  oyConnectorImaging_SetCapability( socket, oyCONNECTOR_IMAGING_CAP_MIN_COLOR_COUNT, 1 );
+  oyConnectorImaging_SetCapability( socket, oyCONNECTOR_IMAGING_CAP_MAX_COLOR_COUNT, 255 );
+  oyConnectorImaging_SetCapability( socket, oyCONNECTOR_IMAGING_CAP_CAN_INTERWOVEN, 1 );
+  oyConnectorImaging_SetCapability( socket, oyCONNECTOR_IMAGING_CAP_ID, 1 );
+
+  clut7 = oyCMMapi7_Create (           oyraCMMInit, oyraCMMMessageFuncSet,
+                                       OY_IMAGE_CLUT_REGISTRATION,
+                                       cmm_version, module_api,
+                                       NULL,
+                                       oyraFilter_ImageClutRun,
+                                       (oyConnector_s**)plugs, 1, 0,
+                                       (oyConnector_s**)sockets, 1, 0,
+                                       0, 0 );
+  return (oyCMMapi_s*) clut7;
+}
+
+const char * oyraApi4UiImageClutGetText (
+                                       const char        * select,
+                                       oyNAME_e            type,
+                                       oyStruct_s        * context OY_UNUSED )
+{
+  if(strcmp(select,"name") == 0)
+  {
+    if(type == oyNAME_NICK)
+      return "image_clut";
+    else if(type == oyNAME_NAME)
+      return _("Image[clut]");
+    else if(type == oyNAME_DESCRIPTION)
+      return _("3D CLUT Image Filter Object");
+  } else if(strcmp(select,"help") == 0)
+  {
+    if(type == oyNAME_NICK)
+      return "help";
+    else if(type == oyNAME_NAME)
+      return _("The filter applies a 3D color look up table.");
+    else if(type == oyNAME_DESCRIPTION)
+    {
+      static char * help_desc = NULL;
+      if(!help_desc)
+        oyStringAddPrintf( &help_desc, 0,0, "%s",
+        _("The filter expects a \"clut\" oyArray2d_s option with float nodes and a \"grid_points\" integer option. The \"//" OY_TYPE_STD "/bake\" policy creates both from a chain of point wise filters.")
+         );
+      return help_desc;
+    }
+  } else if(strcmp(select,"category") == 0)
+  {
+    if(type == oyNAME_NICK)
+      return "category";
+    else if(type == oyNAME_NAME)
+      return _("Image/Simple Image[clut]");
+    else if(type == oyNAME_DESCRIPTION)
+      return _("The filter is used to convert pixels.");
+  }
+  return 0;
+}
+
+
+/** @brief    oyra oyCMMapi4_s implementation
+ *
+ *  a filter applying a 3D CLUT
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/17
+ *  @since   2026/10/17 (Oyranos: 0.9.7)
+ */
+oyCMMapi_s * oyraApi4ImageClutCreate(void)
+{
+  static const char * oyra_api4_ui_image_clut_texts[] = {"name", "help", "category", 0};
+  oyCMMui_s * ui = oyCMMui_Create( "Image/Simple Image[clut]", /* category */
+                                   oyraApi4UiImageClutGetText,
+                                   oyra_api4_ui_image_clut_texts, 0 );
+  int32_t cmm_version[3] = {OYRANOS_VERSION_A,OYRANOS_VERSION_B,OYRANOS_VERSION_C},
+          module_api[3]  = {OYRANOS_VERSION_A,OYRANOS_VERSION_B,OYRANOS_VERSION_C};
+
+  oyCMMapi4_s * clut4 = oyCMMapi4_Create( oyraCMMInit, oyraCMMMessageFuncSet,
+                                       OY_IMAGE_CLUT_REGISTRATION,
+                                       cmm_version, module_api,
+                                       NULL,
+                                       NULL,
+                                       NULL,
+                                       ui,
+                                       NULL );
+  return (oyCMMapi_s*)clut4;
+}
+/* OY_IMAGE_CLUT_REGISTRATION ------------------------------------------------*/
+
+
+/* OY_BAKE_REGISTRATION ------------------------------------------------------*/
+
+/* a copy of the layout with float samples */
+static oyPixel_t oyraFloatLayout_    ( oyPixel_t           pixel_layout )
+{
+  return (pixel_layout & ~oyDataType_m(15)) | oyDataType_m(oyFLOAT);
+}
+
+/** @internal
+ *  Collect the point wise nodes feeding the output node. Each one needs to
+ *  feed only its successor. src becomes the node before the chain. */
+static oyFilterNodes_s * oyraConversion_PointwiseChain_ (
+                                       oyConversion_s    * conversion,
+                                       oyFilterNode_s   ** src,
+                                       oyFilterNode_s   ** out )
+{
+  oyFilterNodes_s * chain = oyFilterNodes_New( 0 );
+  oyFilterNode_s * node, * next;
+  oyFilterSocket_s * socket0 = NULL, * src_socket = NULL;
+  oyFilterPlug_s * plug = NULL;
+
+  *out = oyConversion_GetNode( conversion, OY_OUTPUT );
+  node = oyFilterNode_EdgeCount( *out, 1, OY_FILTEREDGE_CONNECTED ) == 1 ?
+         oyFilterNode_GetPlugNode( *out, 0 ) : NULL;
+
+  while(node &&
+        oyFilterRegistrationMatch( oyFilterNode_GetRegistration( node ),
+                                   "//" OY_TYPE_STD "/.+pointwise", 0 ) &&
+        oyFilterNode_EdgeCount( node, 1, OY_FILTEREDGE_CONNECTED ) == 1 &&
+        oyFilterNode_CountSocketNodes( node, 0, OY_FILTEREDGE_CONNECTED ) == 1)
+  {
+    next = oyFilterNode_GetPlugNode( node, 0 );
+    oyFilterNodes_MoveIn( chain, &node, 0 );
+    node = next;
+  }
+  *src = node;
+
+  /* reconnecting expects the chain at the first socket */
+  if(node && oyFilterNodes_Count( chain ))
+  {
+    next = oyFilterNodes_Get( chain, 0 );
+    plug = oyFilterNode_GetPlug( next, 0 );
+    src_socket = oyFilterPlug_GetSocket( plug );
+    socket0 = oyFilterNode_GetSocket( node, 0 );
+    if(socket0 != src_socket)
+      oyFilterNodes_Clear( chain );
+    oyFilterSocket_Release( &socket0 );
+    oyFilterSocket_Release( &src_socket );
+    oyFilterPlug_Release( &plug );
+    oyFilterNode_Release( &next );
+  }
+
+  return chain;
+}
+
+/** @internal
+ *  Run a float copy of chain over a grid_points^3 image in the colour space
+ *  of image_in. The result is a single row oyArray2d_s of padded nodes. */
+static oyArray2d_s * oyraClutSample_ ( oyFilterNodes_s   * chain,
+                                       oyImage_s         * image_in,
+                                       int                 grid,
+                                       oyObject_s          obj )
+{
+  int error = 0, i, j, n = oyFilterNodes_Count( chain ),
+      count = grid * grid * grid,
+      channels = 0, stride;
+  float * buf_in = oyAllocateFunc_( count * 3 * sizeof(float) ),
+        * buf_out = NULL,
+        * nodes;
+  oyConversion_s * cc = oyConversion_New( obj );
+  oyFilterNode_s * prev = oyFilterNode_NewWith( "//" OY_TYPE_STD "/root", NULL, obj ),
+                 * node, * sample;
+  oyProfile_s * p = oyImage_GetProfile( image_in );
+  oyImage_s * image = oyImage_Create( grid, grid * grid, buf_in,
+                        oyraFloatLayout_( oyImage_GetPixelLayout( image_in, oyLAYOUT ) ),
+                                      p, obj );
+  oyOptions_s * opts;
+  oyArray2d_s * clut = NULL;
+
+  oyProfile_Release( &p );
+  error = !buf_in || !cc || !prev || !image;
+
+  if(!error)
+  {
+    for(i = 0; i < count; ++i)
+    {
+      buf_in[i*3+0] = (float)(i / (grid*grid)) / (grid-1);
+      buf_in[i*3+1] = (float)(i / grid % grid) / (grid-1);
+      buf_in[i*3+2] = (float)(i % grid) / (grid-1);
+    }
+    error = oyConversion_Set( cc, prev, 0 );
+  }
+  /* the conversion owns the root node after oyConversion_Set() only */
+  if(error)
+    oyFilterNode_Release( &prev );
+  if(!error)
+    error = oyFilterNode_SetData( prev, (oyStruct_s*)image, 0, 0 );
+  oyImage_Release( &image );
+
+  /* rebuild the chain with float images of the same colour spaces */
+  for(i = 0; i < n && !error; ++i)
+  {
+    oyPixel_t layout;
+
+    node = oyFilterNodes_Get( chain, i );
+    opts = oyFilterNode_GetOptions( node, 0 );
+    sample = oyFilterNode_NewWith( oyFilterNode_GetRegistration( node ), opts, obj );
+    image = (oyImage_s*) oyFilterNode_GetData( node, 0 );
+    layout = oyImage_GetPixelLayout( image, oyLAYOUT );
+    p = oyImage_GetProfile( image );
+    channels = oyToChannels_m( layout );
+    if(i == n - 1)
+      buf_out = oyAllocateFunc_( count * channels * sizeof(float) );
+    oyImage_Release( &image );
+    image = oyImage_Create( grid, grid * grid, i == n - 1 ? buf_out : NULL,
+                            oyraFloatLayout_( layout ), p, obj );
+    error = !sample || !image || (i == n - 1 && !buf_out);
+    if(!error)
+      error = oyFilterNode_SetData( sample, (oyStruct_s*)image, 0, 0 );
+    if(!error)
+      error = oyFilterNode_Connect( prev, "//" OY_TYPE_STD "/data",
+                                    sample, "//" OY_TYPE_STD "/data", 0 );
+    oyImage_Release( &image );
+    oyProfile_Release( &p );
+    oyOptions_Release( &opts );
+    oyFilterNode_Release( &node );
+    /* the conversion owns the connected nodes; drop unconnected ones */
+    if(error)
+      oyFilterNode_Release( &sample );
+    else
+      prev = sample;
+  }
+
+  if(!error)
+  {
+    sample = oyFilterNode_NewWith( "//" OY_TYPE_STD "/output", NULL, obj );
+    error = oyFilterNode_Connect( prev, "//" OY_TYPE_STD "/data",
+                                  sample, "//" OY_TYPE_STD "/data", 0 );
+    if(!error)
+      error = oyConversion_Set( cc, 0, sample );
+    else
+      oyFilterNode_Release( &sample );
+  }
+
+  if(!error)
+    error = oyConversion_RunPixels( cc, NULL );
+
+  if(!error)
+  {
+    stride = channels > 4 ? channels : 4;
+    clut = oyArray2d_Create( NULL, count * stride, 1, oyFLOAT, obj );
+    error = !clut;
+  }
+
+  if(!error)
+  {
+    nodes = ((float**) oyArray2d_GetData( clut ))[0];
+    memset( nodes, 0, count * stride * sizeof(float) );
+    for(i = 0; i < count; ++i)
+      for(j = 0; j < channels; ++j)
+        nodes[i*stride + j] = buf_out[i*channels + j];
+  }
+
+  if(error)
+    oyArray2d_Release( &clut );
+  oyConversion_Release( &cc );
+  if(buf_in) oyDeAllocateFunc_( buf_in );
+  if(buf_out) oyDeAllocateFunc_( buf_out );
+
+  return clut;
+}
+
+/** Function oyraConversion_Bake
+ *  @brief   replace a point wise chain by a CLUT node
+ *
+ *  The policy implements oyConversion_Correct_f for "//" OY_TYPE_STD "/bake".
+ *  Nodes with the "_pointwise" registration attribute compute each pixel
+ *  from the same pixel only, like ICC conversion, expose and channel
+ *  filters. Such a chain in front of the output node is sampled on a grid
+ *  and replaced by a single "//" OY_TYPE_STD "/clut" node. The input needs
+ *  three channels. Chains of less than two nodes are kept.
+ *
+ *  @code
+    oyOptions_SetFromInt( &opts, "////grid_points", 33, 0, OY_CREATE_NEW );
+    error = oyConversion_Correct( cc, "//" OY_TYPE_STD "/bake", 0, opts );
+    @endcode
+ *
+ *  @par Options:
+ *  - "grid_points" - integer, grid points per channel, 2 - 255, default 33
+ *  - "verbose" - report about changes
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/17
+ *  @since   2026/10/17 (Oyranos: 0.9.7)
+ */
+int      oyraConversion_Bake         ( oyConversion_s    * conversion,
+                                       uint32_t            flags OY_UNUSED,
+                                       oyOptions_s       * options )
+{
+  int error = 0, n,
+      verbose = oyOptions_FindString( options, "verbose", 0 ) ? 1 : 0;
+  int32_t grid = oyraCLUT_GRID;
+  oyFilterNode_s * src = NULL,
+                 * out = NULL,
+                 * first = NULL,
+                 * last = NULL,
+                 * clut_node = NULL;
+  oyFilterNodes_s * chain;
+  oyImage_s * image_in = NULL,
+            * image_out = NULL;
+  oyArray2d_s * clut = NULL;
+  oyOptions_s * opts = NULL;
+
+  oyOptions_FindInt( options, "grid_points", 0, &grid );
+  if(grid < 2 || grid > 255)
+  {
+    oyra_msg( oyMSG_WARN, (oyStruct_s*)conversion, OY_DBG_FORMAT_
+              "grid_points out of range: %d", OY_DBG_ARGS_, grid );
+    return 1;
+  }
+
+  chain = oyraConversion_PointwiseChain_( conversion, &src, &out );
+  n = oyFilterNodes_Count( chain );
+  if(n)
+  {
+    first = oyFilterNodes_Get( chain, 0 );
+    last = oyFilterNodes_Get( chain, n - 1 );
+    image_in = (oyImage_s*) oyFilterNode_GetData( src, 0 );
+    image_out = (oyImage_s*) oyFilterNode_GetData( last, 0 );
+  }
+
+  if(n < 2 || !image_in || !image_out ||
+     !oyraClutCanHandle_( oyImage_GetPixelLayout( image_in, oyLAYOUT ), 3 ) ||
+     !oyraClutCanHandle_( oyImage_GetPixelLayout( image_out, oyLAYOUT ), 0 ))
+  {
+    if(verbose)
+      oyra_msg( oyMSG_DBG, (oyStruct_s*)conversion, OY_DBG_FORMAT_
+                "no point wise chain to bake: %d nodes", OY_DBG_ARGS_, n );
+    goto clean_bake;
+  }
+
+  clut = oyraClutSample_( chain, image_in, grid, NULL );
+  if(!clut)
+  {
+    oyra_msg( oyMSG_WARN, (oyStruct_s*)conversion, OY_DBG_FORMAT_
+              "%s", OY_DBG_ARGS_, _("sampling the point wise chain failed") );
+    error = 1;
+    goto clean_bake;
+  }
+
+  oyOptions_MoveInStruct( &opts, "//" OY_TYPE_STD "/clut/clut",
+                          (oyStruct_s**) &clut, OY_CREATE_NEW );
+  oyOptions_SetFromInt( &opts, "//" OY_TYPE_STD "/clut/grid_points", grid, 0,
+                        OY_CREATE_NEW );
+  clut_node = oyFilterNode_NewWith( "//" OY_TYPE_STD "/clut", opts, NULL );
+  error = !clut_node;
+  if(!error)
+    error = oyFilterNode_SetData( clut_node, (oyStruct_s*)image_out, 0, 0 );
+
+  if(!error)
+  {
+    if(verbose)
+      oyra_msg( oyMSG_DBG, (oyStruct_s*)conversion, OY_DBG_FORMAT_
+                "bake %d nodes into node[%d] with %d grid points",
+                OY_DBG_ARGS_, n, oyFilterNode_GetId( clut_node ), grid );
+    /* detach the chain; reconnecting restores the source and output */
+    oyFilterNode_Disconnect( first, 0 );
+    oyFilterNode_Disconnect( out, 0 );
+    error = oyFilterNode_Connect( src, "//" OY_TYPE_STD "/data",
+                                  clut_node, "//" OY_TYPE_STD "/data", 0 );
+    if(!error)
+      error = oyFilterNode_Connect( clut_node, "//" OY_TYPE_STD "/data",
+                                    out, "//" OY_TYPE_STD "/data", 0 );
+  }
+
+  /* on success the new node stays referenced as a member of the graph */
+  if(error)
+    oyFilterNode_Release( &clut_node );
+  else
+  {
+    /* the conversion releases only nodes in its graph; drop its references */
+    int i;
+    for(i = 0; i < n; ++i)
+    {
+      oyFilterNode_s * node = oyFilterNodes_Get( chain, i ),
+                     * owned = node;
+      oyFilterNode_Release( &node );
+      oyFilterNode_Release( &owned );
+    }
+  }
+
+  clean_bake:
+  oyOptions_Release( &opts );
+  oyImage_Release( &image_in );
+  oyImage_Release( &image_out );
+  oyFilterNode_Release( &first );
+  oyFilterNode_Release( &last );
+  oyFilterNodes_Release( &chain );
+  oyFilterNode_Release( &src );
+  oyFilterNode_Release( &out );
+
+  return error;
+}
+
+/** @brief    oyra bake policy oyCMMapi9_s implementation
+ *
+ *  The policy replaces point wise node chains by a CLUT node. Call it with
+ *  oyConversion_Correct( conversion, "//" OY_TYPE_STD "/bake", 0, options ).
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/17
+ *  @since   2026/10/17 (Oyranos: 0.9.7)
+ */
+oyCMMapi9_s_  oyra_api9_bake = {
+
+  oyOBJECT_CMM_API9_S, /* oyStruct_s::type */
+  0,0,0, /* unused oyStruct_s fileds; keep to zero */
+  (oyCMMapi_s*) & oyra_api10_profile_graph2d_SaturationLine, /* oyCMMapi_s * next */
+
+  oyraCMMInit, /* oyCMMInit_f */
+  oyraCMMMessageFuncSet, /* oyCMMMessageFuncSet_f */
+
+  /* registration */
+  OY_TOP_SHARED OY_SLASH OY_DOMAIN_INTERNAL OY_SLASH OY_TYPE_STD OY_SLASH "bake." CMM_NICK,
+
+  CMM_VERSION, /* int32_t version[3] */
+  CMM_API_VERSION, /**< int32_t module_api[3] */
+  0,   /* id_; keep empty */
+  0,   /* oyCMMapi5_s    * api5_; keep empty */
+  0,   /* runtime_context */
+
+  0, /* oyCMMFilter_ValidateOptions_f */
+  0, /* oyWidgetEvent_f */
+
+  0, /* options */
+  0, /* oyCMMuiGet_f oyCMMuiGet */
+  0, /* xml_namespace */
+
+  0, /* object_types */
+
+  0,  /* getText */
+  0,  /* texts */
+
+  /** oyConversion_Correct_f oyConversion_Correct; check a graph */
+  oyraConversion_Bake,
+
+  /** const char * pattern; a pattern supported by oyraConversion_Bake */
+  "//" OY_TYPE_STD "/bake",
+
+  /** const char * key_base; a key base used in options */
+  OY_STD "/bake",
+
+  0, /* oyCMMGetFallback_f oyCMMGetFallback */
+  0, /* oyCMMRegistrationToName_f oyCMMRegistrationToName */
+  0  /* oyCMMGetDefaultPattern_f oyCMMGetDefaultPattern */
+};
+/* OY_BAKE_REGISTRATION ------------------------------------------------------*/
+/* ---------------------------------------------------------------------------*/
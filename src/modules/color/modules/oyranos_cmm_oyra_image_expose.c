@@ -340,7 +340,7 @@ int      oyraFilter_ImageExposeRun   ( oyFilterPlug_s    * requestor_plug,
 }
 
 
-#define OY_IMAGE_EXPOSE_REGISTRATION OY_TOP_SHARED OY_SLASH OY_DOMAIN_INTERNAL OY_SLASH OY_TYPE_STD OY_SLASH "expose"
+#define OY_IMAGE_EXPOSE_REGISTRATION OY_TOP_SHARED OY_SLASH OY_DOMAIN_INTERNAL OY_SLASH OY_TYPE_STD OY_SLASH "expose._pointwise"
 
 /** @brief    oyra oyCMMapi7_s implementation
  *
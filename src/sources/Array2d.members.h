@@ -9,6 +9,11 @@
                                             - 0 not owned by the object
                                             - 1 one own monolithic memory block
                                                 starting in array2d[0]
-                                            - 2 several owned memory blocks */
+                                            - 2 several owned memory blocks
+                                            - 3 one own aligned memory block
+                                                in block_ with padded rows */
   oyStructList_s     * refs_;          /**< references of other arrays to this*/
   oyArray2d_s        * refered_;       /**< array this one refers to */
+  oyPointer            block_;         /**< start of the aligned memory block for own_lines == 3 */
+  int                  stride_;        /**< bytes from one row to the next; 0 if unknown */
+  size_t               block_size_;    /**< pool bucket size of block_; 0 if not from the pool */
@@ -0,0 +1,5 @@
+/** alignment in bytes of rows in a oyArray2d_AllocateBlock_() block */
+#define OY_ARRAY2D_ALIGN 64
+/** default byte budget of released blocks kept for reuse,
+ *  see oyArray2d_SetPoolBudget() */
+#define OY_ARRAY2D_POOL_BUDGET (64*1024*1024)
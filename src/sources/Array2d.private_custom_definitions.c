@@ -1,4 +1,5 @@
 #include "oyranos_image_internal.h"
+#include "oyranos_sentinel.h"
 
 /** Function    oyArray2d_Release__Members
  *  @memberof   oyArray2d_s
@@ -9,5 +9,7 @@ oyArray2d_s_ *
                                        oyObject_s          object );
 int
              oyArray2d_ReleaseArray_ ( oyArray2d_s       * obj );
+int          oyArray2d_AllocateBlock_( oyArray2d_s_      * s );
+size_t       oyArray2d_PoolSetBudget_( size_t              budget );
 int              oyArray2d_ToPPM_    ( oyArray2d_s_      * array,
                                        const char        * file_name );
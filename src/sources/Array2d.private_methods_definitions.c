@@ -1,3 +1,120 @@
+/* released aligned blocks kept for reuse by oyArray2d_AllocateBlock_() */
+#define OY_ARRAY2D_POOL_MAX 64
+typedef struct {
+  size_t               size;           /* bucket size */
+  oyPointer            block;
+} oyArray2dPoolEntry_;
+static oyArray2dPoolEntry_ oy_array2d_pool_[OY_ARRAY2D_POOL_MAX];
+static int oy_array2d_pool_n_ = 0;
+static size_t oy_array2d_pool_bytes_ = 0;
+static size_t oy_array2d_pool_budget_ = OY_ARRAY2D_POOL_BUDGET;
+static oyPointer oy_array2d_pool_lock_ = NULL;
+
+/* create the pool lock once under the library wide lock */
+static void oyArray2d_PoolLockInit_  ( void )
+{
+  oyLockFunc_( oy_struct_global_lock_, __func__, __LINE__ );
+  if(!oy_array2d_pool_lock_)
+    oy_array2d_pool_lock_ = oyStruct_LockCreateFunc_( NULL );
+  oyUnLockFunc_( oy_struct_global_lock_, __func__, __LINE__ );
+}
+
+#define oyArray2dPoolLock_m_ { \
+  if(!oy_array2d_pool_lock_) oyArray2d_PoolLockInit_(); \
+  oyLockFunc_( oy_array2d_pool_lock_, __func__, __LINE__ ); }
+#define oyArray2dPoolUnLock_m_ \
+  oyUnLockFunc_( oy_array2d_pool_lock_, __func__, __LINE__ );
+
+/* Round up to a bucket. The step is a power of two between 1/8 and 1/4 of
+ * size. So a bucket wastes at most a quarter and similar sizes meet. */
+static size_t oyArray2d_PoolBucket_  ( size_t              size )
+{
+  size_t step = 4096;
+  while(step * 8 <= size)
+    step *= 2;
+  return (size + step - 1) / step * step;
+}
+
+/* drop the oldest entries until size fits into the budget */
+static void oyArray2d_PoolTrim_      ( size_t              size )
+{
+  while(oy_array2d_pool_n_ &&
+        (oy_array2d_pool_bytes_ + size > oy_array2d_pool_budget_ ||
+         oy_array2d_pool_n_ >= OY_ARRAY2D_POOL_MAX))
+  {
+    oyDeAllocateFunc_( oy_array2d_pool_[0].block );
+    oy_array2d_pool_bytes_ -= oy_array2d_pool_[0].size;
+    --oy_array2d_pool_n_;
+    memmove( &oy_array2d_pool_[0], &oy_array2d_pool_[1],
+             sizeof(oyArray2dPoolEntry_) * oy_array2d_pool_n_ );
+  }
+}
+
+/* free all kept blocks; registered for oyFinish_() */
+static void oyArray2d_PoolFinish_    ( void )
+{
+  size_t budget;
+
+  oyArray2dPoolLock_m_
+  budget = oy_array2d_pool_budget_;
+  oy_array2d_pool_budget_ = 0;
+  oyArray2d_PoolTrim_( 0 );
+  oy_array2d_pool_budget_ = budget;
+  oyArray2dPoolUnLock_m_
+}
+
+/* round *size up to its bucket and take a block of exactly that size;
+ * returns 0 if pooling is disabled */
+static int oyArray2d_PoolGet_        ( size_t            * size,
+                                       oyPointer         * block )
+{
+  int i, pooled;
+
+  oyArray2dPoolLock_m_
+  pooled = oy_array2d_pool_budget_ != 0;
+  if(pooled)
+  {
+    *size = oyArray2d_PoolBucket_( *size );
+    for(i = oy_array2d_pool_n_ - 1; i >= 0; --i)
+      if(oy_array2d_pool_[i].size == *size)
+      {
+        *block = oy_array2d_pool_[i].block;
+        oy_array2d_pool_bytes_ -= *size;
+        --oy_array2d_pool_n_;
+        memmove( &oy_array2d_pool_[i], &oy_array2d_pool_[i+1],
+                 sizeof(oyArray2dPoolEntry_) * (oy_array2d_pool_n_ - i) );
+        break;
+      }
+  }
+  oyArray2dPoolUnLock_m_
+
+  return pooled;
+}
+
+/* keep a block for reuse; returns 1 if the caller shall free it */
+static int oyArray2d_PoolPut_        ( oyPointer           block,
+                                       size_t              size )
+{
+  int error = 0;
+
+  oyArray2dPoolLock_m_
+  if(size > oy_array2d_pool_budget_)
+    error = 1;
+  else
+  {
+    if(!oy_array2d_pool_n_)
+      oyFinishAdd_( oyArray2d_PoolFinish_ );
+    oyArray2d_PoolTrim_( size );
+    oy_array2d_pool_[oy_array2d_pool_n_].size = size;
+    oy_array2d_pool_[oy_array2d_pool_n_].block = block;
+    ++oy_array2d_pool_n_;
+    oy_array2d_pool_bytes_ += size;
+  }
+  oyArray2dPoolUnLock_m_
+
+  return error;
+}
+
 /** Function  oyArray2d_Init_
  *  @memberof oyArray2d_s
  *  @brief    Initialise Array
@@ -25,6 +142,9 @@ int                oyArray2d_Init_   ( oyArray2d_s_      * s,
     oyAllocHelper_m_( s->array2d, unsigned char *, height + 1, s->oy_->allocateFunc_, return 1 );
     error = !memset( s->array2d, 0, y_len );
     s->own_lines = oyNO;
+    s->block_ = NULL;
+    s->stride_ = 0;
+    s->block_size_ = 0;
   }
   return error;
 }
@@ -100,12 +220,102 @@ int          oyArray2d_ReleaseArray_ ( oyArray2d_s       * obj )
         deallocateFunc( &s->array2d[y][dsize * (int)OY_ROUND(s->data_area.x)] );
       s->array2d[y] = 0;
     }
+    if(s->own_lines == 3 && s->block_ &&
+       !(s->block_size_ && oyArray2d_PoolPut_( s->block_, s->block_size_ ) == 0))
+      deallocateFunc( s->block_ );
+    s->block_ = NULL;
+    s->stride_ = 0;
+    s->block_size_ = 0;
     deallocateFunc( s->array2d + (int)OY_ROUND(s->data_area.y) );
     s->array2d = 0;
   }
 
   return error;
 }
+
+/** Function  oyArray2d_PoolSetBudget_
+ *  @memberof oyArray2d_s
+ *  @brief    Set the byte budget of the block pool
+ *  @internal
+ *
+ *  @param[in]     budget              bytes; 0 frees all kept blocks and
+ *                                     disables pooling
+ *  @return                            the previous budget
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/16
+ *  @since   2026/10/16 (Oyranos: 0.9.7)
+ */
+size_t       oyArray2d_PoolSetBudget_( size_t              budget )
+{
+  size_t old;
+
+  oyArray2dPoolLock_m_
+  old = oy_array2d_pool_budget_;
+  oy_array2d_pool_budget_ = budget;
+  oyArray2d_PoolTrim_( 0 );
+  oyArray2dPoolUnLock_m_
+
+  return old;
+}
+
+/** Function  oyArray2d_AllocateBlock_
+ *  @memberof oyArray2d_s
+ *  @brief    Allocate all rows in one aligned memory block
+ *  @internal
+ *
+ *  The rows of the data area are placed in one memory block. Each row
+ *  starts at a OY_ARRAY2D_ALIGN byte boundary. So the stride is padded
+ *  to a multiple of OY_ARRAY2D_ALIGN. Previously set rows are ignored and
+ *  should not be owned by the array. With the default allocators blocks
+ *  are taken from and given back to a size bucketed pool. That avoids
+ *  large malloc/free cycles in repeated runs.
+ *
+ *  @param[in,out] s                   the array with initialised row table
+ *  @return                            error
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/16
+ *  @since   2026/10/16 (Oyranos: 0.9.7)
+ */
+int          oyArray2d_AllocateBlock_( oyArray2d_s_      * s )
+{
+  int error = !s || !s->array2d;
+  int y, height, pooled;
+  size_t stride, size;
+  uintptr_t start;
+  unsigned char * block = NULL;
+
+  if(error)
+    return error;
+
+  height = s->data_area.height;
+  stride = s->data_area.width * oyDataTypeGetSize( s->t );
+  stride = (stride + OY_ARRAY2D_ALIGN - 1) & ~((size_t)OY_ARRAY2D_ALIGN - 1);
+  size = stride * height + OY_ARRAY2D_ALIGN - 1;
+
+  /* recycle blocks of released arrays with the default allocator */
+  pooled = s->oy_->allocateFunc_ == oyAllocateFunc_ &&
+           s->oy_->deallocateFunc_ == oyDeAllocateFunc_ &&
+           oyArray2d_PoolGet_( &size, (oyPointer*)&block );
+  if(block)
+    memset( block, 0, size );
+  if(!block)
+    oyStruct_AllocHelper_m_( block, unsigned char, size, s, return 1 );
+
+  start = ((uintptr_t)block + OY_ARRAY2D_ALIGN - 1) &
+          ~((uintptr_t)OY_ARRAY2D_ALIGN - 1);
+  for(y = 0; y < height; ++y)
+    s->array2d[y + (int)OY_ROUND(s->data_area.y)] =
+                               (unsigned char*)start + y * stride;
+
+  s->block_ = block;
+  s->stride_ = stride;
+  s->own_lines = 3;
+  s->block_size_ = pooled ? size : 0;
+
+  return error;
+}
  
 /** Function  oyArray2d_ToPPM_
  *  @memberof oyArray2d_s
@@ -40,6 +40,50 @@ OYAPI oyArray2d_s * OYEXPORT
   return (oyArray2d_s*)s;
 }
 
+/** Function  oyArray2d_CreateAligned
+ *  @memberof oyArray2d_s
+ *  @brief    Allocate a oyArray2d_s object with one aligned memory block
+ *
+ *  All rows are placed inside one memory block. Each row starts at a 64 byte
+ *  boundary. The distance between rows can be obtained from
+ *  oyArray2d_GetStride() and is possibly larger than the row data. So the
+ *  whole array can be passed to line stride aware functions at once.
+ *
+ *  @param[in]     width               width in samples
+ *  @param[in]     height              height in lines
+ *  @param[in]     data_type           sample type
+ *  @param[in]     object              the optional object
+ *  @return                            the array
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/16
+ *  @since   2026/10/16 (Oyranos: 0.9.7)
+ */
+OYAPI oyArray2d_s * OYEXPORT
+                 oyArray2d_CreateAligned (
+                                       int                 width,
+                                       int                 height,
+                                       oyDATATYPE_e        data_type,
+                                       oyObject_s          object )
+{
+  oyArray2d_s_ * s = NULL;
+  int error = 0;
+
+  if(!width || !height)
+    return (oyArray2d_s*)s;
+
+  s = oyArray2d_Create_( width, height, data_type, object );
+  error = !s;
+
+  if(error <= 0)
+    error = oyArray2d_AllocateBlock_( s );
+
+  if(error > 0)
+    oyArray2d_Release( (oyArray2d_s**)&s );
+
+  return (oyArray2d_s*)s;
+}
+
 #if 0
 /** Function  oyArray2d_DataCopy
  *  @memberof oyArray2d_s
@@ -178,6 +222,7 @@ OYAPI int  OYEXPORT
       error = !memset( s->array2d, 0, y_len );
 
     s->own_lines = oyNO;
+    s->stride_ = oyDataTypeGetSize( s->t ) * s->width;
 
     if(error <= 0)
       for( y = 0; y < s->height; ++y )
@@ -235,6 +280,7 @@ OYAPI int  OYEXPORT
       error = !memset( s->array2d, 0, y_len );
 
     s->own_lines = do_copy;
+    s->stride_ = do_copy == 1 ? size : 0;
 
     if(error <= 0 && s->own_lines == 2)
     {
@@ -274,6 +320,82 @@ OYAPI int  OYEXPORT
   return error;
 }
 
+/** Function  oyArray2d_SetDataStride
+ *  @memberof oyArray2d_s
+ *  @brief    Let the rows point into a strided memory block
+ *
+ *  The rows alias the provided memory without copy. A negative stride
+ *  describes bottom-up images. data points always to the first row of the
+ *  array, which is then the highest address in memory.
+ *
+ *  @param[in,out] obj                 struct object
+ *  @param[in]     data                the first row
+ *  @param[in]     stride              bytes from one row to the next;
+ *                                     0 means tightly packed rows
+ *  @param[in]     own_data            - 0 : the caller keeps the memory
+ *                                     - 1 : the array releases the memory
+ *                                       with its deallocator; the block
+ *                                       starts at the lowest row
+ *  @return                            error
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/16
+ *  @since   2026/10/16 (Oyranos: 0.9.7)
+ */
+OYAPI int  OYEXPORT
+                 oyArray2d_SetDataStride (
+                                       oyArray2d_s       * obj,
+                                       oyPointer           data,
+                                       int                 stride,
+                                       int                 own_data )
+{
+  oyArray2d_s_ * s = (oyArray2d_s_*)obj;
+  int error = 0;
+
+  if(!data)
+    return 1;
+
+  if(!s)
+    return 0;
+
+  oyCheckType__m( oyOBJECT_ARRAY2D_S, return 1 )
+
+  {
+    int y_len = sizeof(unsigned char *) * (s->height + 1),
+        y;
+    int size = s->width * oyDataTypeGetSize( s->t );
+    uint8_t * u8 = data;
+
+    if(stride == 0)
+      stride = size;
+
+    if(abs(stride) < size)
+    {
+      WARNc2_S( "stride %d is smaller than a row: %d", stride, size );
+      return 1;
+    }
+
+    oyArray2d_ReleaseArray_( (oyArray2d_s*)s );
+
+    /* allocate the base array */
+    oyStruct_AllocHelper_m_( s->array2d, unsigned char *, s->height+1, s,
+                             error = 1; return 1 );
+    if(error <= 0)
+      error = !memset( s->array2d, 0, y_len );
+
+    if(error <= 0)
+      for( y = 0; y < s->height; ++y )
+        s->array2d[y] = y ? s->array2d[y-1] + stride : u8;
+
+    s->stride_ = stride;
+    s->own_lines = own_data ? 3 : oyNO;
+    if(own_data)
+      s->block_ = stride > 0 ? u8 : s->array2d[s->height - 1];
+  }
+
+  return error;
+}
+
 /** Function  oyArray2d_SetFocus
  *  @memberof oyArray2d_s
  *  @brief    Move a arrays active area to a given rectangle
@@ -448,6 +570,61 @@ OYAPI int  OYEXPORT
   return s->height;
 }
 
+/** Function  oyArray2d_GetStride
+ *  @memberof oyArray2d_s
+ *  @brief    Get the distance of rows in memory
+ *
+ *  The stride is known for arrays from oyArray2d_CreateAligned(),
+ *  oyArray2d_Create(), oyArray2d_SetData(), oyArray2d_SetDataStride() and
+ *  a monolithic oyArray2d_SetRows() copy. Otherwise rows can be anywhere in
+ *  memory.
+ *
+ *  @param[in]     array               the channels array
+ *  @return                            bytes from one row to the next,
+ *                                     negative for bottom-up memory
+ *                                     or 0 for unknown
+ *
+ *  @version  Oyranos: 0.9.7
+ *  @date     2026/10/16
+ *  @since    2026/10/16 (Oyranos: 0.9.7)
+ */
+OYAPI int  OYEXPORT
+                 oyArray2d_GetStride ( oyArray2d_s       * array )
+{
+  oyArray2d_s_ * s = (oyArray2d_s_*) array;
+  if(!array)
+    return 0;
+  return s->stride_;
+}
+
+/** Function  oyArray2d_SetPoolBudget
+ *  @memberof oyArray2d_s
+ *  @brief    Limit the memory of the array block pool
+ *
+ *  Arrays from oyArray2d_CreateAligned() and the arrays, which
+ *  oyImage_FillArray() and the lcm2 module create for each run, place their
+ *  rows in one block. Released blocks are kept process wide in size
+ *  buckets and reused by the next array of similar size. So repeated
+ *  oyConversion_RunPixels() calls, e.g. while panning or zooming, avoid
+ *  large malloc/free cycles. Kept blocks above the budget are freed
+ *  oldest first. Only arrays with the default allocators take part.
+ *
+ *  @param[in]     budget              bytes to keep at most;
+ *                                     0 frees all kept blocks and disables
+ *                                     the pool; default is 64 MiB
+ *  @return                            the previous budget
+ *
+ *  @version  Oyranos: 0.9.7
+ *  @date     2026/10/16
+ *  @since    2026/10/16 (Oyranos: 0.9.7)
+ */
+OYAPI size_t  OYEXPORT
+                 oyArray2d_SetPoolBudget (
+                                       size_t              budget )
+{
+  return oyArray2d_PoolSetBudget_( budget );
+}
+
 /** Function  oyArray2d_GetType
  *  @memberof oyArray2d_s
  *  @brief    Get data Type
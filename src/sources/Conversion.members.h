@@ -1,2 +1,8 @@
   oyFilterNode_s_    * input;          /**< the input image filter; Most users will start logically with this pice and chain their filters to get the final result. */
   oyFilterNode_s_    * out_;           /**< @private the Oyranos output image. Oyranos will stream the filters starting from the end. This element will be asked on its first plug. */
+  oyPixelAccess_s    * ticket_;        /**< @private prepared job ticket for oyConversion_RunColors() */
+  int                  async_serial_;  /**< @private counter of oyConversion_RunPixelsAsync() jobs */
+  int                  async_canceled_; /**< @private jobs up to this serial are canceled by oyConversion_Cancel() */
+  oyStructList_s     * tile_cache_;    /**< @private oyHash_s entries with results of oyConversion_RunPixels(), most recent last */
+  size_t               tile_cache_budget_; /**< @private bytes for tile_cache_, see oyConversion_SetTileCache() */
+  int                  stats_tile_hits_; /**< @private tile_cache_ hits, see oyConversion_GetStats() */
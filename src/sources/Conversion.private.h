@@ -0,0 +1,2 @@
+/** pixels per row of a oyConversion_CreateColors() conversion */
+#define OY_CONVERSION_COLORS 32
@@ -1,3 +1,41 @@
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+/** Function  oyConversion_Cancel
+ *  @memberof oyConversion_s
+ *  @brief    Stop background jobs of a conversion
+ *
+ *  All jobs from oyConversion_RunPixelsAsync(), which are started before
+ *  this call, skip their remaining tiles. They finish with
+ *  oyJob_s::status_work_return set to -1. Jobs started afterwards run
+ *  normally. The function returns immediately; a running tile is completed
+ *  by its job.
+ *
+ *  @param[in,out] conversion          conversion object
+ *  @return                            0 on success, else error
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/16
+ *  @since   2026/10/16 (Oyranos: 0.9.7)
+ */
+int                oyConversion_Cancel(oyConversion_s    * conversion )
+{
+  oyConversion_s_ * s = (oyConversion_s_*)conversion;
+
+  oyCheckType__m( oyOBJECT_CONVERSION_S, return 1 )
+
+  oyObject_Lock( s->oy_, __FILE__, __LINE__ );
+  /* read without the lock by the tile loop in oyConversion_RunTiled_() */
+#if defined(_OPENMP)
+#pragma omp atomic write
+#endif
+  s->async_canceled_ = s->async_serial_;
+  oyObject_UnLock( s->oy_, __FILE__, __LINE__ );
+
+  return 0;
+}
+
 /** Function  oyConversion_Correct
  *  @memberof oyConversion_s
  *  @brief    Check for correctly adhering to policies
@@ -106,6 +144,34 @@ int                oyConversion_Correct (
   return error;
 }
 
+/* let output share the pixel array of input for in place processing;
+ * returns -1 if the images are not compatible */
+static int oyConversion_ShareInPlace_( oyImage_s         * input,
+                                       oyImage_s         * output )
+{
+  oyImage_s_ * in = (oyImage_s_*)input,
+             * out = (oyImage_s_*)output;
+  oyStruct_s * a = NULL;
+
+  if(!in->pixel_data || in->pixel_data->type_ != oyOBJECT_ARRAY2D_S ||
+     in->layout_[oyCOFF] != 1 || !in->setLine ||
+     in->layout_[oyLAYOUT] != out->layout_[oyLAYOUT] ||
+     in->width != out->width || in->height != out->height)
+  {
+    WARNc2_S( "in_place ignored for different images: %s %s",
+              oyStruct_GetText( (oyStruct_s*)input, oyNAME_NICK, 0 ),
+              oyStruct_GetText( (oyStruct_s*)output, oyNAME_NICK, 0 ) );
+    return -1;
+  }
+
+  if(in->pixel_data == out->pixel_data)
+    return 0;
+
+  a = in->pixel_data->copy( in->pixel_data, 0 );
+  return oyImage_SetData( output, &a, in->getPoint, in->getLine, 0,
+                          in->setPoint, in->setLine, 0 );
+}
+
 /** Function  oyConversion_CreateBasicPixels
  *  @memberof oyConversion_s
  *  @brief    Allocate and initialise a basic oyConversion_s object
@@ -118,6 +184,14 @@ int                oyConversion_Correct (
  *  Provided options will be passed to oyFilterNode_NewWith(). There for no
  *  options defaults will be selected.
  *
+ *  The "in_place" option, e.g. "//" OY_TYPE_STD "/in_place" = "1", lets
+ *  the output image share the pixel array of the input image. Both images
+ *  need the same pixel layout and size. The color transform then runs on
+ *  one single buffer. The copy into a intermediate array and the copy
+ *  back into the output image are skipped. After the run the input
+ *  pixels are replaced by the converted ones. Typical is a 8-bit RGBA
+ *  display conversion.
+ *
  *  @param[in]     input               the input image data
  *  @param[in]     output              the output image data
  *  @param[in]     options             options to be passed to oyFilterCore_s
@@ -134,8 +208,8 @@ int                oyConversion_Correct (
  *  @param         object              the optional object
  *  @return                            the conversion context
  *
- *  @version Oyranos: 0.9.6
- *  @date    2014/06/29
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/16
  *  @since   2008/06/26 (Oyranos: 0.1.8)
  */
 oyConversion_s   * oyConversion_CreateBasicPixels (
@@ -147,6 +221,43 @@ oyConversion_s   * oyConversion_CreateBasicPixels (
   oyConversion_s * s = 0;
   int error = !input || !output;
   oyFilterNode_s * in = 0, * out = 0;
+  int32_t in_place = 0;
+  oyOptions_s * node_options = NULL;
+  const char * o_txt = NULL;
+
+  /* accept "in_place" as integer and as string option */
+  if(error <= 0 &&
+     oyOptions_FindInt( options, "in_place", 0, &in_place ) != 0)
+  {
+    o_txt = oyOptions_FindString( options, "in_place", 0 );
+    if(o_txt && oyStrlen_(o_txt))
+      in_place = atoi( o_txt );
+  }
+
+  if(error <= 0 && in_place)
+  {
+    int i, n;
+
+    oyConversion_ShareInPlace_( input, output );
+
+    /* "in_place" is for the conversion only; as a edited option it would
+     * block the context fallbacks in oyFilterNode_FromOptions() */
+    node_options = oyOptions_Copy( options, 0 );
+    n = oyOptions_Count( node_options );
+    for(i = 0; i < n; ++i)
+    {
+      oyOption_s * o = oyOptions_Get( node_options, i );
+      int found = oyFilterRegistrationMatch( oyOption_GetRegistration(o),
+                                             "in_place", 0 );
+      oyOption_Release( &o );
+      if(found)
+      {
+        oyOptions_ReleaseAt( node_options, i );
+        break;
+      }
+    }
+    options = node_options;
+  }
 
   if(error <= 0)
   {
@@ -185,6 +296,7 @@ oyConversion_s   * oyConversion_CreateBasicPixels (
 
   if(error)
     oyConversion_Release ( &s );
+  oyOptions_Release( &node_options );
 
   return s;
 }
@@ -195,7 +307,8 @@ oyConversion_s   * oyConversion_CreateBasicPixels (
  *
  *  The options are passed to oyConversion_CreateBasicPixels();
  *  The function does the lookups for the profiles and the modules contexts
- *  in the Oyranos cache on the fly.
+ *  in the Oyranos cache on the fly. For rows with padding see
+ *  oyConversion_CreateBasicPixelsFromStrides().
  *
  *  @param[in]     p_in                the input profile
  *  @param[in]     buf_in              the input channels
@@ -273,6 +386,170 @@ oyConversion_s *   oyConversion_CreateBasicPixelsFromBuffers (
   return conv;
 }
 
+/** Function  oyConversion_CreateBasicPixelsFromStrides
+ *  @memberof oyConversion_s
+ *  @brief    Two dimensional color conversion context on strided buffers
+ *
+ *  The buffers are wrapped by oyImage_CreateFromStride() without copy.
+ *  Padded rows and bottom-up frames with negative strides can be converted
+ *  in place of their owner, e.g. a video pipeline. The buffers remain in
+ *  the responsibility of the caller and must live as long as the
+ *  conversion runs. The options are passed to
+ *  oyConversion_CreateBasicPixels().
+ *
+ *  @param[in]     p_in                the input profile
+ *  @param[in]     buf_in              the first row of input channels
+ *  @param[in]     stride_in           bytes between input rows; 0 for packed
+ *  @param[in]     buf_type_in         the input pixel type; channel count can be omitted
+ *  @param[in]     p_out               the output profile
+ *  @param[in]     buf_out             the first row of output channels
+ *  @param[in]     stride_out          bytes between output rows; 0 for packed
+ *  @param[in]     buf_type_out        the output pixel type; channel count can be omitted
+ *  @param[in]     options             see the same option in  oyConversion_CreateBasicPixels()
+ *  @param[in]     width               the pixel count per row
+ *  @param[in]     height              the row count
+ *  @return                            the conversion context
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/16
+ *  @since   2026/10/16 (Oyranos: 0.9.7)
+ */
+oyConversion_s *   oyConversion_CreateBasicPixelsFromStrides (
+                                       oyProfile_s       * p_in,
+                                       oyPointer           buf_in,
+                                       int                 stride_in,
+                                       oyPixel_t           buf_type_in,
+                                       oyProfile_s       * p_out,
+                                       oyPointer           buf_out,
+                                       int                 stride_out,
+                                       oyPixel_t           buf_type_out,
+                                       oyOptions_s       * options,
+                                       int                 width,
+                                       int                 height )
+{
+  oyImage_s * in  = NULL,
+            * out = NULL;
+  oyConversion_s * conv = NULL;
+  int cchan;
+
+  if(width <= 0 || height <= 0)
+  {
+    WARNc2_S("buffer requested with size of pixels: %dx%d", width, height);
+    return NULL;
+  }
+
+  if(!buf_in || !buf_out)
+  {
+    WARNc1_S("buffer%s missed", (!buf_in && !buf_out) ? "s" : "");
+    return NULL;
+  }
+
+  cchan = oyProfile_GetChannelsCount( p_in );
+  if(!oyToChannels_m( buf_type_in ) && cchan)
+    buf_type_in |= oyChannels_m(cchan);
+  in   = oyImage_CreateFromStride( width, height, buf_in, stride_in, 0,
+                                   buf_type_in, p_in, 0 );
+
+  cchan = oyProfile_GetChannelsCount( p_out );
+  if(!oyToChannels_m( buf_type_out ) && cchan)
+    buf_type_out |= oyChannels_m(cchan);
+  out  = oyImage_CreateFromStride( width, height, buf_out, stride_out, 0,
+                                   buf_type_out, p_out, 0 );
+
+  if(in && out)
+    conv = oyConversion_CreateBasicPixels( in,out, options, 0 );
+
+  oyImage_Release( &in );
+  oyImage_Release( &out );
+
+  return conv;
+}
+
+/** Function  oyConversion_CreateColors
+ *  @memberof oyConversion_s
+ *  @brief    Prepared conversion for color lists
+ *
+ *  The graph, module contexts and job ticket are set up once for the
+ *  profiles, pixel types and options. oyConversion_RunColors() converts
+ *  then any number of colors with the prepared graph. That is much cheaper
+ *  than a new conversion per color, e.g. for color pickers, palettes or
+ *  vector graphics. The options are passed to
+ *  oyConversion_CreateBasicPixels().
+ *
+ *  A prepared conversion shall be used by one thread at a time.
+ *
+ *  @param[in]     p_in                the input profile
+ *  @param[in]     buf_type_in         the input pixel type; channel count can be omitted
+ *  @param[in]     p_out               the output profile
+ *  @param[in]     buf_type_out        the output pixel type; channel count can be omitted
+ *  @param[in]     options             see the same option in  oyConversion_CreateBasicPixels()
+ *  @param[in]     obj                 the optional object
+ *  @return                            the prepared conversion
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/16
+ *  @since   2026/10/16 (Oyranos: 0.9.7)
+ */
+oyConversion_s *   oyConversion_CreateColors (
+                                       oyProfile_s       * p_in,
+                                       oyPixel_t           buf_type_in,
+                                       oyProfile_s       * p_out,
+                                       oyPixel_t           buf_type_out,
+                                       oyOptions_s       * options,
+                                       oyObject_s          obj )
+{
+  oyImage_s * in  = NULL,
+            * out = NULL;
+  oyConversion_s * conv = NULL;
+  oyFilterNode_s * node_out = NULL;
+  oyFilterPlug_s * plug = NULL;
+  oyArray2d_s * array = NULL;
+  int cchan, error = 0;
+
+  cchan = oyProfile_GetChannelsCount( p_in );
+  if(!oyToChannels_m( buf_type_in ) && cchan)
+    buf_type_in |= oyChannels_m(cchan);
+  cchan = oyProfile_GetChannelsCount( p_out );
+  if(!oyToChannels_m( buf_type_out ) && cchan)
+    buf_type_out |= oyChannels_m(cchan);
+
+  /* the images hold own rows for short color lists */
+  in   = oyImage_Create( OY_CONVERSION_COLORS, 1, NULL, buf_type_in, p_in,
+                         obj );
+  out  = oyImage_Create( OY_CONVERSION_COLORS, 1, NULL, buf_type_out, p_out,
+                         obj );
+
+  conv = oyConversion_CreateBasicPixels( in,out, options, obj );
+  if(!conv)
+    error = 1;
+
+  if(error <= 0)
+  {
+    node_out = oyConversion_GetNode( conv, OY_OUTPUT );
+    plug = oyFilterNode_GetPlug( node_out, 0 );
+    oyConversionPriv_m(conv)->ticket_ = oyPixelAccess_Create( 0,0, plug,
+                                                 oyPIXEL_ACCESS_IMAGE, obj );
+    /* write directly into the output image */
+    array = (oyArray2d_s*) oyImage_GetPixelData( out );
+    error = oyPixelAccess_SetArray( oyConversionPriv_m(conv)->ticket_,
+                                    array, 0 );
+    oyArray2d_Release( &array );
+    oyFilterPlug_Release( &plug );
+    oyFilterNode_Release( &node_out );
+  }
+
+  if(error > 0 || (conv && !oyConversionPriv_m(conv)->ticket_))
+  {
+    WARNc_S("could not prepare color conversion");
+    oyConversion_Release( &conv );
+  }
+
+  oyImage_Release( &in );
+  oyImage_Release( &out );
+
+  return conv;
+}
+
 /** Function oyConversion_CreateFromImage
  *  @memberof oyConversion_s
  *  @brief   generate a Oyranos graph from a image file name
@@ -520,6 +797,9 @@ oyFilterNode_s   * oyConversion_GetNode (
  *  @memberof oyConversion_s
  *  @brief    Compute one pixel at the given position
  *
+ *  For converting single colors without a image see
+ *  oyConversion_CreateColors() and oyConversion_RunColors().
+ *
  *  @param[in,out] conversion          conversion object
  *  @param[in]     x                   position x
  *  @param[in]     y                   position y
@@ -553,148 +833,538 @@ int          oyConversion_GetOnePixel( oyConversion_s    * conversion,
   return error;
 }
 
-/** Function  oyConversion_RunPixels
+/** Function  oyConversion_GetStats
  *  @memberof oyConversion_s
- *  @brief    Process a pixel conversion graph
- *
- *  @param[in,out] conversion          conversion object
- *  @param[in,out] pixel_access        optional custom pixel iterator
- *                                     configuration;
- *                                     The ticket can be passed in for
- *                                     specifying only regions of the source
- *                                     data.
- *  @return                            0 on success, else error
+ *  @brief    Get the execution counters of a graph as JSON
  *
- *  @version Oyranos: 0.1.10
- *  @since   2008/07/06 (Oyranos: 0.1.8)
- *  @date    2009/03/06
+ *  Each node with counters from oyConversion_SetStats() is listed with:
+ *  - "calls": number of oyFilterNode_Run() calls
+ *  - "time": wall time in seconds, including the input nodes
+ *  - "self_time": "time" without the time of the direct input nodes;
+ *    this is exact for graphs, where each node has one consumer
+ *  - "pixels": pixels requested by the job tickets
+ *  - "bytes": size of pixel arrays, which the node attached to a ticket
+ *  - "cache_hits" and "cache_misses": node contexts from the Oyranos cache
+ *    and from the module
  *
- *  Here a very basic code snippet:
+ *  "tile_cache_hits" counts regions from oyConversion_SetTileCache(). In
+ *  parallel runs the times of concurrent tiles add up.
  *  @code
-    // use the output
-    oyConversion_RunPixels( conversion, NULL );
-    oyImage_s * image = oyConversion_GetImage( conversion, OY_OUTPUT );
-    // get the data and draw the image
-    for(i = 0; i < image->height; ++i)
     {
-      image_data = oyImage_GetLineF(image)( image, i, &height, -1, &is_allocated );
-
-      // ...
-
-      if(is_allocated)
-        free( image_data );
+      "tile_cache_hits": 0,
+      "nodes": [
+        { "id": 12, "registration": "org/freedesktop/openicc/icc_color/lcm2",
+          "calls": 2, "time": 0.012, "self_time": 0.011, "pixels": 2747,
+          "bytes": 0, "cache_hits": 1, "cache_misses": 0 }
+      ]
     } @endcode
  *
- *  Here a example from test2.cpp for creating a job ticket from the DAG:
- *  @dontinclude test2.cpp
-    @skip create a basic job ticket for faster repeats of oyConversion_RunPixels()
-    @until oyFilterPlug_Release
+ *  @param[in]     conversion          conversion object
+ *  @param[in]     allocateFunc        user allocator
+ *  @return                            the JSON text
  *
- *  oyFilterGraph_PrepareContexts() uses the internal oyFilterNode_SetContext_()
- *  for automatic resources resolving during DAG processing. Both oyCMMapi4_s
- *  and oyCMMapi7_s contexts are checked for if declared by oyCMMapi4_Create()
- *  context_type argument.
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/16
+ *  @since   2026/10/16 (Oyranos: 0.9.7)
  */
-int                oyConversion_RunPixels (
+char *             oyConversion_GetStats (
                                        oyConversion_s    * conversion,
-                                       oyPixelAccess_s   * pixel_access )
+                                       oyAlloc_f           allocateFunc )
 {
   oyConversion_s_ * s = (oyConversion_s_*)conversion;
-  oyFilterPlug_s * plug = 0;
-  oyFilterNode_s * node_out = 0;
-  oyImage_s * image_out = 0,
-            * image_input = 0;
-  int error = 0, result = 0, dirty = 0;
-  oyRectangle_s_ roi = {oyOBJECT_RECTANGLE_S, 0,0,0, 0,0,0,0};
-  double clck;
+  oyFilterGraph_s * graph;
+  char * json = NULL, * text;
+  int n, i, j, first = 1;
 
-  oyPixelAccess_s_ * pixel_access_ = (oyPixelAccess_s_*)oyPixelAccess_Copy(pixel_access,NULL);
+  oyCheckType__m( oyOBJECT_CONVERSION_S, return 0 )
 
-  oyCheckType__m( oyOBJECT_CONVERSION_S, return 1 )
+  if(!allocateFunc)
+    allocateFunc = oyAllocateFunc_;
 
-  /* should be the same as conversion->out_->filter */
-  node_out = oyConversion_GetNode( conversion, OY_OUTPUT );
-  plug = oyFilterNode_GetPlug( node_out, 0 );
+  graph = oyConversion_GetGraph( conversion );
+  n = oyFilterGraph_CountNodes( graph, "", NULL );
 
-  /* basic checks */
-  if(!plug)
+  oyStringAddPrintf_( &json, oyAllocateFunc_, oyDeAllocateFunc_,
+                      "{\n  \"tile_cache_hits\": %d,\n  \"nodes\": [",
+                      s->stats_tile_hits_ );
+
+  for(i = 0; i < n; ++i)
   {
-    WARNc1_S("graph incomplete [%d]", s ? oyObject_GetId( s->oy_ ) : -1)
-    return 1;
-  }
+    oyFilterNode_s_ * node = (oyFilterNode_s_*) oyFilterGraph_GetNode( graph,
+                                                             i, "", NULL );
+    oyFilterNodeStats_s_ stats;
+    double self_time;
+    int plugs_n;
 
-  /* conversion->out_ has to be linear, so we access only the first plug */
+    if(!node->stats_)
+    {
+      oyFilterNode_Release( (oyFilterNode_s**)&node );
+      continue;
+    }
 
-  if(!pixel_access_)
-  {
-    /** The function creates a very simple pixel iterator if no job ticket
-        is passed in as __pixel_access__. */
-    if(plug)
+    oyObject_Lock( node->oy_, __FILE__, __LINE__ );
+    stats = *node->stats_;
+    oyObject_UnLock( node->oy_, __FILE__, __LINE__ );
+
+    /* input nodes run inside this node */
+    self_time = stats.seconds;
+    plugs_n = oyFilterNode_EdgeCount( (oyFilterNode_s*)node, 1, 0 );
+    for(j = 0; j < plugs_n; ++j)
     {
-      if(oy_debug) clck = oyClock();
-      pixel_access_ = (oyPixelAccess_s_*)oyPixelAccess_Create( 0,0, plug,
-                                                      oyPIXEL_ACCESS_IMAGE, 0 );
-      if(oy_debug)
-      { clck = oyClock() - clck;
-        DBG_PROG1_S("oyPixelAccess_Create(): %g", clck/1000000.0 );
-      }
+      oyFilterNode_s_ * input = (oyFilterNode_s_*) oyFilterNode_GetPlugNode(
+                                                 (oyFilterNode_s*)node, j );
+      if(input && input->stats_)
+        self_time -= input->stats_->seconds;
+      oyFilterNode_Release( (oyFilterNode_s**)&input );
     }
+    if(self_time < 0)
+      self_time = 0;
+
+    oyStringAddPrintf_( &json, oyAllocateFunc_, oyDeAllocateFunc_,
+                        "%s\n    { \"id\": %d, \"registration\": \"%s\",\n"
+                        "      \"calls\": %d, \"time\": %g, \"self_time\": %g,"
+                        " \"pixels\": %.0f,\n"
+                        "      \"bytes\": %.0f, \"cache_hits\": %d,"
+                        " \"cache_misses\": %d }",
+                        first ? "" : ",", oyObject_GetId( node->oy_ ),
+                        oyNoEmptyString_m_( oyFilterNode_GetRegistration(
+                                                   (oyFilterNode_s*)node ) ),
+                        stats.calls, stats.seconds, self_time, stats.pixels,
+                        stats.bytes, stats.cache_hits, stats.cache_misses );
+    first = 0;
+
+    oyFilterNode_Release( (oyFilterNode_s**)&node );
   }
+  oyFilterGraph_Release( &graph );
 
-  if(!pixel_access_)
-    error = 1;
+  oyStringAddPrintf_( &json, oyAllocateFunc_, oyDeAllocateFunc_,
+                      "\n  ]\n}\n" );
 
-  image_out = oyConversion_GetImage( conversion, OY_OUTPUT );
+  text = oyStringCopy( json, allocateFunc );
+  oyFree_m_( json );
 
-  if(error <= 0)
-    oyRectangle_SetByRectangle( (oyRectangle_s*)&roi,
-                                (oyRectangle_s*)pixel_access_->output_array_roi );
+  return text;
+}
 
-  if(error <= 0 && !pixel_access_->array)
-  {
-    if(oy_debug) clck = oyClock();
-    result = oyImage_FillArray( image_out, (oyRectangle_s*)&roi, 0,
-                                &pixel_access_->array,
-                                (oyRectangle_s*)pixel_access_->output_array_roi, 0 );
-    if(oy_debug)
-    { clck = oyClock() - clck;
-      DBGs_PROG1_S( pixel_access_,"oyImage_FillArray(): %g", clck/1000000.0 );
-    }
-    error = ( result != 0 );
-  }
+/* point the single row of a prepared color array to caller memory or, with
+ * row = NULL, to a own row of size bytes */
+static oyPointer oyConversion_ColorsRow_( oyArray2d_s_      * a,
+                                       oyPointer           row,
+                                       size_t              size )
+{
+  oyPointer block;
 
-  /* run on the graph */
-  if(error <= 0)
+  if(row)
   {
-    DBGs_PROG2_S( pixel_access_, "Run: node_out[%d] image_out[%d]",
-                 oyStruct_GetId((oyStruct_s*)node_out),
-                 oyStruct_GetId((oyStruct_s*)image_out) );
-    if(oy_debug) clck = oyClock();
-    error = oyFilterNodePriv_m(node_out)->api7_->oyCMMFilterPlug_Run( plug,
-                                             (oyPixelAccess_s*)pixel_access_ );
-    if(oy_debug)
-    { clck = oyClock() - clck;
-      DBG_PROG1_S( "conversion->out_->api7_->oyCMMFilterPlug_Run(): %g",
-                clck/1000000.0 );
-      DBGs_PROG1_S( pixel_access_, 
-         "conversion->out_->api7_->oyCMMFilterPlug_Run(): %g", clck/1000000.0 );
-    }
-  }
-
-  if(error != 0 && pixel_access_)
+    /* the row array of a wrapping array can simply be moved */
+    if(a->own_lines == oyNO && a->array2d)
+      a->array2d[0] = row;
+    else if(oyArray2d_SetDataStride( (oyArray2d_s*)a, row, 0, 0 ))
+      return NULL;
+  } else if(a->own_lines == oyNO)
   {
-    dirty = oyOptions_FindString( (oyOptions_s*)pixel_access_->graph->options, "dirty", "true")
-            ? 1 : 0;
+    block = a->oy_->allocateFunc_( size );
+    if(!block || oyArray2d_SetDataStride( (oyArray2d_s*)a, block, 0, 1 ))
+      return NULL;
+  }
 
-    /* refresh the graph representation */
-    if(oy_debug) clck = oyClock();
-    oyFilterGraph_SetFromNode( (oyFilterGraph_s*)pixel_access_->graph, (oyFilterNode_s*)s->input, 0, 0 );
-    if(oy_debug)
-    { clck = oyClock() - clck;
-      DBGs_PROG1_S(pixel_access_,"oyFilterGraph_SetFromNode(): %g",clck/1000000.0 );
-    }
+  return a->array2d[0];
+}
 
-    /* resolve missing data */
+/** Function  oyConversion_RunColors
+ *  @memberof oyConversion_s
+ *  @brief    Convert a list of colors with a prepared conversion
+ *
+ *  The buffers are converted in pieces of the prepared width. Each piece
+ *  runs the prepared graph and job ticket of the conversion without
+ *  any new graph setup. Full pieces are converted in the caller buffers
+ *  without copy. Only a shorter last piece goes through internal rows.
+ *
+ *  @code
+    oyConversion_s * cc = oyConversion_CreateColors( p_in, oyDOUBLE,
+                                                     p_out, oyUINT8, 0, 0 );
+    double lab[3*n];
+    uint8_t rgb[3*n];
+    error = oyConversion_RunColors( cc, lab, rgb, n );
+    oyConversion_Release( &cc ); @endcode
+ *
+ *  @param[in,out] conversion          from oyConversion_CreateColors()
+ *  @param[in]     buf_in              the input colors
+ *  @param[out]    buf_out             the output colors
+ *  @param[in]     count               the number of colors
+ *  @return                            0 on success, else error
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/16
+ *  @since   2026/10/16 (Oyranos: 0.9.7)
+ */
+int                oyConversion_RunColors (
+                                       oyConversion_s    * conversion,
+                                       oyPointer           buf_in,
+                                       oyPointer           buf_out,
+                                       int                 count )
+{
+  oyConversion_s_ * s = (oyConversion_s_*)conversion;
+  oyImage_s * in = NULL,
+            * out = NULL;
+  oyArray2d_s_ * a_in = NULL,
+               * a_out = NULL;
+  oyPixel_t pt;
+  oyPointer row_in, row_out;
+  size_t bpp_in, bpp_out;
+  int width = 0, done, n, error = 0;
+
+  oyCheckType__m( oyOBJECT_CONVERSION_S, return 1 )
+
+  if(!s->ticket_ || !buf_in || !buf_out || count < 0)
+  {
+    WARNc1_S( "need buffers and a conversion from oyConversion_CreateColors() [%d]",
+              oyObject_GetId( s->oy_ ) );
+    return 1;
+  }
+
+  in  = oyConversion_GetImage( conversion, OY_INPUT );
+  out = oyConversion_GetImage( conversion, OY_OUTPUT );
+  a_in  = (oyArray2d_s_*) oyImage_GetPixelData( in );
+  a_out = (oyArray2d_s_*) oyImage_GetPixelData( out );
+  if(!a_in || !a_out)
+    error = 1;
+
+  if(error <= 0)
+  {
+    width = oyImage_GetWidth( in );
+    pt = oyImage_GetPixelLayout( in, oyLAYOUT );
+    bpp_in  = oyToChannels_m(pt) * oyDataTypeGetSize( oyToDataType_m(pt) );
+    pt = oyImage_GetPixelLayout( out, oyLAYOUT );
+    bpp_out = oyToChannels_m(pt) * oyDataTypeGetSize( oyToDataType_m(pt) );
+  }
+
+  for(done = 0; error <= 0 && done < count; done += n)
+  {
+    n = OY_MIN( width, count - done );
+
+    if(n == width)
+    {
+      row_in  = oyConversion_ColorsRow_( a_in, (char*)buf_in + done * bpp_in,
+                                         0 );
+      row_out = oyConversion_ColorsRow_( a_out, (char*)buf_out + done * bpp_out,
+                                         0 );
+    } else
+    {
+      /* do not touch memory behind the callers last color */
+      row_in  = oyConversion_ColorsRow_( a_in, NULL, width * bpp_in );
+      row_out = oyConversion_ColorsRow_( a_out, NULL, width * bpp_out );
+      if(row_in)
+        memcpy( row_in, (char*)buf_in + done * bpp_in, n * bpp_in );
+    }
+
+    if(!row_in || !row_out)
+      error = 1;
+
+    if(error <= 0)
+      error = oyConversion_RunPixels( conversion, s->ticket_ );
+
+    if(error <= 0 && n < width)
+      memcpy( (char*)buf_out + done * bpp_out, row_out, n * bpp_out );
+  }
+
+  oyArray2d_Release( (oyArray2d_s**)&a_in );
+  oyArray2d_Release( (oyArray2d_s**)&a_out );
+  oyImage_Release( &in );
+  oyImage_Release( &out );
+
+  return error;
+}
+
+/* the key of a oyConversion_SetTileCache() entry covers the node contexts,
+ * the node data and the requested region with its scale */
+static char * oyConversion_TileKey_  ( oyConversion_s    * conversion,
+                                       oyPixelAccess_s_  * ticket,
+                                       oyImage_s         * image_out )
+{
+  oyFilterGraph_s * graph = oyConversion_GetGraph( conversion );
+  oyArray2d_s * a = ticket->array;
+  char * key = NULL, * text;
+  int n = oyFilterGraph_CountNodes( graph, "", NULL ), i;
+
+  for(i = 0; i < n; ++i)
+  {
+    oyFilterNode_s * node = oyFilterGraph_GetNode( graph, i, "", NULL );
+    oyStruct_s * data = oyFilterNode_GetData( node, 0 );
+
+    text = oyFilterNode_GetHashText_( (oyFilterNode_s_*)node, 4 );
+    oyStringAddPrintf_( &key, oyAllocateFunc_, oyDeAllocateFunc_,
+                        "%s data[%d]\n", text ? text : "",
+                        data ? oyStruct_GetId( data ) : -1 );
+
+    if(text) oyDeAllocateFunc_( text );
+    if(data && data->release) data->release( &data );
+    oyFilterNode_Release( &node );
+  }
+  oyFilterGraph_Release( &graph );
+
+  oyStringAddPrintf_( &key, oyAllocateFunc_, oyDeAllocateFunc_,
+                      "start: %g,%g roi: %s",
+                      ticket->start_xy[0], ticket->start_xy[1],
+                      oyRectangle_Show( (oyRectangle_s*)ticket->output_array_roi ) );
+  oyStringAddPrintf_( &key, oyAllocateFunc_, oyDeAllocateFunc_,
+                      " out: %dx%d array: %dx%d %d",
+                      oyImage_GetWidth( image_out ),
+                      oyImage_GetHeight( image_out ),
+                      oyArray2d_GetWidth( a ), oyArray2d_GetHeight( a ),
+                      oyArray2d_GetType( a ) );
+
+  return key;
+}
+
+/* copy the rows of equally shaped arrays */
+static int oyConversion_TileCopy_    ( oyArray2d_s_      * dst,
+                                       oyArray2d_s_      * src )
+{
+  int y, size;
+
+  if(!dst || !src || dst->width != src->width ||
+     dst->height != src->height || dst->t != src->t)
+    return 1;
+
+  size = dst->width * oyDataTypeGetSize( dst->t );
+  for(y = 0; y < dst->height; ++y)
+    memcpy( dst->array2d[y], src->array2d[y], size );
+
+  return 0;
+}
+
+/* obtain a tile and mark it as most recently used; needs the object lock */
+static oyArray2d_s * oyConversion_TileGet_ (
+                                       oyConversion_s_   * s,
+                                       const char        * key )
+{
+  oyHash_s * hash = oyStructList_GetHash( s->tile_cache_, 0, key ),
+           * entry;
+  oyArray2d_s * tile = (oyArray2d_s*) oyHash_GetPointer( hash,
+                                                      oyOBJECT_ARRAY2D_S );
+  int n = oyStructList_Count( s->tile_cache_ ), i;
+
+  if(tile)
+  {
+    tile = oyArray2d_Copy( tile, NULL );
+    for(i = 0; i < n - 1; ++i)
+    {
+      entry = (oyHash_s*) oyStructList_GetRefType( s->tile_cache_, i,
+                                                   oyOBJECT_HASH_S );
+      if(entry == hash)
+      {
+        oyStructList_ReleaseAt( s->tile_cache_, i );
+        oyStructList_MoveIn( s->tile_cache_, (oyStruct_s**)&entry, -1, 0 );
+        break;
+      }
+      oyHash_Release( &entry );
+    }
+  }
+
+  oyHash_Release( &hash );
+
+  return tile;
+}
+
+/* store a copy of a tile and drop the least recently used ones beyond the
+ * budget; needs the object lock */
+static void oyConversion_TilePut_    ( oyConversion_s_   * s,
+                                       const char        * key,
+                                       oyArray2d_s       * array )
+{
+  oyHash_s * hash = oyStructList_GetHash( s->tile_cache_, 0, key );
+  oyArray2d_s * tile = oyArray2d_Create( NULL, oyArray2d_GetWidth( array ),
+                                         oyArray2d_GetHeight( array ),
+                                         oyArray2d_GetType( array ), NULL );
+  size_t bytes = 0;
+  int i;
+
+  if(oyConversion_TileCopy_( (oyArray2d_s_*)tile, (oyArray2d_s_*)array ) == 0)
+    oyHash_SetPointer( hash, (oyStruct_s*)tile );
+  oyArray2d_Release( &tile );
+  oyHash_Release( &hash );
+
+  for(i = oyStructList_Count( s->tile_cache_ ) - 1; i >= 0; --i)
+  {
+    hash = (oyHash_s*) oyStructList_GetRefType( s->tile_cache_, i,
+                                                oyOBJECT_HASH_S );
+    tile = (oyArray2d_s*) oyHash_GetPointer( hash, oyOBJECT_ARRAY2D_S );
+    if(tile)
+      bytes += (size_t)oyArray2d_GetWidth( tile ) * oyArray2d_GetHeight( tile ) *
+               oyDataTypeGetSize( oyArray2d_GetType( tile ) );
+    if(!tile || bytes > s->tile_cache_budget_)
+      oyStructList_ReleaseAt( s->tile_cache_, i );
+    oyHash_Release( &hash );
+  }
+}
+
+/** Function  oyConversion_RunPixels
+ *  @memberof oyConversion_s
+ *  @brief    Process a pixel conversion graph
+ *
+ *  @param[in,out] conversion          conversion object
+ *  @param[in,out] pixel_access        optional custom pixel iterator
+ *                                     configuration;
+ *                                     The ticket can be passed in for
+ *                                     specifying only regions of the source
+ *                                     data.
+ *  @return                            0 on success, else error
+ *
+ *  @version Oyranos: 0.1.10
+ *  @since   2008/07/06 (Oyranos: 0.1.8)
+ *  @date    2009/03/06
+ *
+ *  Here a very basic code snippet:
+ *  @code
+    // use the output
+    oyConversion_RunPixels( conversion, NULL );
+    oyImage_s * image = oyConversion_GetImage( conversion, OY_OUTPUT );
+    // get the data and draw the image
+    for(i = 0; i < image->height; ++i)
+    {
+      image_data = oyImage_GetLineF(image)( image, i, &height, -1, &is_allocated );
+
+      // ...
+
+      if(is_allocated)
+        free( image_data );
+    } @endcode
+ *
+ *  Here a example from test2.cpp for creating a job ticket from the DAG:
+ *  @dontinclude test2.cpp
+    @skip create a basic job ticket for faster repeats of oyConversion_RunPixels()
+    @until oyFilterPlug_Release
+ *
+ *  oyFilterGraph_PrepareContexts() uses the internal oyFilterNode_SetContext_()
+ *  for automatic resources resolving during DAG processing. Both oyCMMapi4_s
+ *  and oyCMMapi7_s contexts are checked for if declared by oyCMMapi4_Create()
+ *  context_type argument.
+ *
+ *  With oyConversion_SetTileCache() a region, which was computed before with
+ *  the same graph settings, is copied from memory.
+ */
+int                oyConversion_RunPixels (
+                                       oyConversion_s    * conversion,
+                                       oyPixelAccess_s   * pixel_access )
+{
+  oyConversion_s_ * s = (oyConversion_s_*)conversion;
+  oyFilterPlug_s * plug = 0;
+  oyFilterNode_s * node_out = 0;
+  oyImage_s * image_out = 0,
+            * image_input = 0;
+  int error = 0, result = 0, dirty = 0, cached = 0;
+  oyRectangle_s_ roi = {oyOBJECT_RECTANGLE_S, 0,0,0, 0,0,0,0};
+  oyArray2d_s_ * tile = 0;
+  char * tile_key = 0;
+  double clck;
+
+  oyPixelAccess_s_ * pixel_access_ = (oyPixelAccess_s_*)oyPixelAccess_Copy(pixel_access,NULL);
+
+  oyCheckType__m( oyOBJECT_CONVERSION_S, return 1 )
+
+  /* should be the same as conversion->out_->filter */
+  node_out = oyConversion_GetNode( conversion, OY_OUTPUT );
+  plug = oyFilterNode_GetPlug( node_out, 0 );
+
+  /* basic checks */
+  if(!plug)
+  {
+    WARNc1_S("graph incomplete [%d]", s ? oyObject_GetId( s->oy_ ) : -1)
+    return 1;
+  }
+
+  /* conversion->out_ has to be linear, so we access only the first plug */
+
+  if(!pixel_access_)
+  {
+    /** The function creates a very simple pixel iterator if no job ticket
+        is passed in as __pixel_access__. */
+    if(plug)
+    {
+      if(oy_debug) clck = oyClock();
+      pixel_access_ = (oyPixelAccess_s_*)oyPixelAccess_Create( 0,0, plug,
+                                                      oyPIXEL_ACCESS_IMAGE, 0 );
+      if(oy_debug)
+      { clck = oyClock() - clck;
+        DBG_PROG1_S("oyPixelAccess_Create(): %g", clck/1000000.0 );
+      }
+    }
+  }
+
+  if(!pixel_access_)
+    error = 1;
+
+  image_out = oyConversion_GetImage( conversion, OY_OUTPUT );
+
+  if(error <= 0)
+    oyRectangle_SetByRectangle( (oyRectangle_s*)&roi,
+                                (oyRectangle_s*)pixel_access_->output_array_roi );
+
+  if(error <= 0 && !pixel_access_->array)
+  {
+    if(oy_debug) clck = oyClock();
+    result = oyImage_FillArray( image_out, (oyRectangle_s*)&roi, 0,
+                                &pixel_access_->array,
+                                (oyRectangle_s*)pixel_access_->output_array_roi, 0 );
+    if(oy_debug)
+    { clck = oyClock() - clck;
+      DBGs_PROG1_S( pixel_access_,"oyImage_FillArray(): %g", clck/1000000.0 );
+    }
+    error = ( result != 0 );
+  }
+
+  /* a revisited region comes from oyConversion_SetTileCache() */
+  if(error <= 0 && s->tile_cache_)
+  {
+    oyObject_Lock( s->oy_, __FILE__, __LINE__ );
+    if(oyImage_CountDirty( image_out ))
+      oyStructList_Clear( s->tile_cache_ );
+    else
+    {
+      tile_key = oyConversion_TileKey_( conversion, pixel_access_, image_out );
+      tile = (oyArray2d_s_*) oyConversion_TileGet_( s, tile_key );
+      if(tile)
+        ++s->stats_tile_hits_;
+    }
+    oyObject_UnLock( s->oy_, __FILE__, __LINE__ );
+
+    cached = oyConversion_TileCopy_( (oyArray2d_s_*)pixel_access_->array,
+                                     tile ) == 0;
+  }
+
+  /* run on the graph */
+  if(error <= 0 && !cached)
+  {
+    DBGs_PROG2_S( pixel_access_, "Run: node_out[%d] image_out[%d]",
+                 oyStruct_GetId((oyStruct_s*)node_out),
+                 oyStruct_GetId((oyStruct_s*)image_out) );
+    if(oy_debug) clck = oyClock();
+    error = oyFilterNode_Run( node_out, plug,
+                              (oyPixelAccess_s*)pixel_access_ );
+    if(oy_debug)
+    { clck = oyClock() - clck;
+      DBG_PROG1_S( "conversion->out_->api7_->oyCMMFilterPlug_Run(): %g",
+                clck/1000000.0 );
+      DBGs_PROG1_S( pixel_access_, 
+         "conversion->out_->api7_->oyCMMFilterPlug_Run(): %g", clck/1000000.0 );
+    }
+  }
+
+  if(error != 0 && pixel_access_)
+  {
+    dirty = oyOptions_FindString( (oyOptions_s*)pixel_access_->graph->options, "dirty", "true")
+            ? 1 : 0;
+
+    /* refresh the graph representation */
+    if(oy_debug) clck = oyClock();
+    oyFilterGraph_SetFromNode( (oyFilterGraph_s*)pixel_access_->graph, (oyFilterNode_s*)s->input, 0, 0 );
+    if(oy_debug)
+    { clck = oyClock() - clck;
+      DBGs_PROG1_S(pixel_access_,"oyFilterGraph_SetFromNode(): %g",clck/1000000.0 );
+    }
+
+    /* resolve missing data */
     if(oy_debug) clck = oyClock();
     image_input = oyFilterPlug_ResolveImage( plug, (oyFilterSocket_s*)((oyFilterPlug_s_*)plug)->remote_socket_,
                                              (oyPixelAccess_s*)pixel_access_ );
@@ -736,8 +1406,8 @@ int                oyConversion_RunPixels (
                      "oyFilterGraph_PrepareContexts(): %g", clck/1000000.0 );
           clck = oyClock();
         }
-        error = s->out_->api7_->oyCMMFilterPlug_Run( plug,
-                                              (oyPixelAccess_s*)pixel_access_);
+        error = oyFilterNode_Run( node_out, plug,
+                                  (oyPixelAccess_s*)pixel_access_ );
         if(oy_debug)
         { clck = oyClock() - clck;
           DBGs_PROG1_S( pixel_access_,
@@ -750,6 +1420,12 @@ int                oyConversion_RunPixels (
   DBGs_PROG1_S( pixel_access_, "image_out: %s",
                 oyStruct_GetText((oyStruct_s*)image_out, oyNAME_NAME, 0) );
   oyPixelAccess_SetArrayFocus( (oyPixelAccess_s*)pixel_access_, 0 );
+  if(error == 0 && tile_key && !cached)
+  {
+    oyObject_Lock( s->oy_, __FILE__, __LINE__ );
+    oyConversion_TilePut_( s, tile_key, pixel_access_->array );
+    oyObject_UnLock( s->oy_, __FILE__, __LINE__ );
+  }
   if(oy_debug)
   {
     oyRectangle_s * pix = NULL; oyImage_RoiToSamples( image_out,
@@ -779,8 +1455,8 @@ int                oyConversion_RunPixels (
    *
    * While the design of having whatever data storage in a oyImage_s is very
    * flexible, the oyPixelAccess_s::array's in memory buffer is not.
-   * Users with very large data sets have to process the data in chunks and
-   * the oyPixelAccess_s::array allocation can remain constant.
+   * Users with very large data sets can process the data in bands with
+   * oyConversion_RunPixelsTiled() and images from oyImage_CreateFromLines().
    */
   if(image_out && oyImagePriv_m(image_out)->pixel_data->type_ == oyOBJECT_ARRAY2D_S && pixel_access_ &&
      ((oyPointer)oyImagePriv_m(image_out)->pixel_data != (oyPointer)pixel_access_->array ||
@@ -795,6 +1471,8 @@ int                oyConversion_RunPixels (
   }
 
   oyPixelAccess_Release( (oyPixelAccess_s**)&pixel_access_ );
+  oyArray2d_Release( (oyArray2d_s**)&tile );
+  if(tile_key) oyDeAllocateFunc_( tile_key );
 
   oyImage_Release( &image_out );
   oyFilterPlug_Release( &plug );
@@ -803,35 +1481,977 @@ int                oyConversion_RunPixels (
   return error;
 }
 
-/** Function  oyConversion_Set
- *  @memberof oyConversion_s
- *  @brief    Set input and output of a conversion graph
- *
- *  @param[in,out] conversion          conversion object
- *  @param[in]     input               input node
- *  @param[in]     output              output node
- *  @return                            0 on success, else error
- *
- *  @version Oyranos: 0.1.10
- *  @since   2009/03/05 (Oyranos: 0.1.10)
- *  @date    2009/03/05
- */
-int                oyConversion_Set  ( oyConversion_s    * conversion,
-                                       oyFilterNode_s    * input,
-                                       oyFilterNode_s    * output )
+/* process one tile of oyConversion_RunPixelsTiled() with a own ticket;
+ * tile_pix is placed in image_out, shift_* move it to the source start */
+static int oyConversion_RunTile_     ( oyFilterNode_s    * node_out,
+                                       oyFilterPlug_s    * plug,
+                                       oyPixelAccess_s   * pattern,
+                                       oyImage_s         * image_out,
+                                       oyRectangle_s_    * tile_pix,
+                                       double              shift_x,
+                                       double              shift_y )
 {
-  oyConversion_s_ * s = (oyConversion_s_*)conversion;
+  oyPixelAccess_s * ticket = NULL;
+  oyArray2d_s * a = NULL;
+  oyRectangle_s * roi = NULL;
+  oyRectangle_s_ image_roi = {oyOBJECT_RECTANGLE_S, 0,0,0, 0,0,0,0};
+  oyRectangle_s_ array_pix = {oyOBJECT_RECTANGLE_S, 0,0,0, 0,0,0,0};
+  int channels = oyImage_GetPixelLayout( image_out, oyCHANS ),
+      width = oyImage_GetWidth( image_out );
+  oyDATATYPE_e data_type = oyToDataType_m( oyImage_GetPixelLayout( image_out,
+                                                                 oyLAYOUT ) );
   int error = 0;
 
-  oyCheckType__m( oyOBJECT_CONVERSION_S, return 1 )
+  if(!channels || !width)
+    return 1;
 
-  if(input)
-    s->input = (oyFilterNode_s_*)oyFilterNode_Copy(input,NULL);
+  /* The derived ticket shares the graph, but owns a array for the tile.
+   * So no two tiles write to the same memory before oyImage_ReadArray(). */
+  ticket = oyPixelAccess_Copy( pattern, pattern->oy_ );
+  a = oyArray2d_CreateAligned( tile_pix->width * channels, tile_pix->height,
+                               data_type, NULL );
+  error = !ticket || !a;
 
-  if(output)
-    s->out_ = (oyFilterNode_s_*)oyFilterNode_Copy(output,NULL);
+  if(error <= 0)
+  {
+    oyPixelAccess_SetArray( ticket, a, 0 );
+    oyRectangle_SetGeo( (oyRectangle_s*)&array_pix, 0, 0,
+                        tile_pix->width, tile_pix->height );
+    oyPixelAccess_PixelsToRoi( ticket, (oyRectangle_s*)&array_pix, &roi );
+    error = oyPixelAccess_ChangeRectangle( ticket,
+                                           (tile_pix->x + shift_x) / width,
+                                           (tile_pix->y + shift_y) / width, roi );
+  }
 
-  return error;
+  if(error <= 0)
+    error = oyFilterNode_Run( node_out, plug, ticket );
+
+  if(error <= 0)
+  {
+    oyArray2d_Release( &a );
+    a = oyPixelAccess_GetArray( ticket );
+    oyRectangle_SetGeo( (oyRectangle_s*)&image_roi,
+                        tile_pix->x / width, tile_pix->y / width,
+                        tile_pix->width / width, tile_pix->height / width );
+    error = oyImage_ReadArray( image_out, (oyRectangle_s*)&image_roi, a, 0 );
+  }
+
+  oyRectangle_Release( &roi );
+  oyArray2d_Release( &a );
+  oyPixelAccess_Release( &ticket );
+
+  return error;
+}
+
+/* a job of oyConversion_RunPixelsAsync() is canceled by oyConversion_Cancel() */
+static int oyConversion_Canceled_    ( oyConversion_s_   * s,
+                                       oyJob_s           * job,
+                                       int                 serial )
+{
+  int canceled = 0;
+
+  if(job)
+  {
+#if defined(_OPENMP)
+#pragma omp atomic read
+#endif
+    canceled = s->async_canceled_;
+  }
+
+  return job && canceled >= serial;
+}
+
+/* send progress per finished band of tiles to oyJob_s::cb_progress */
+static void oyConversion_JobProgress_( oyJob_s           * job,
+                                       int                 done,
+                                       int                 tiles_n,
+                                       int                 tiles_x )
+{
+  char * t = NULL;
+
+  if(!job || !job->cb_progress || !tiles_x)
+    return;
+
+  if(done % tiles_x == 0 || done == tiles_n)
+  {
+    oyStringAddPrintf( &t, oyAllocateFunc_, oyDeAllocateFunc_,
+                       "band %d/%d", (done + tiles_x - 1) / tiles_x,
+                       (tiles_n + tiles_x - 1) / tiles_x );
+    oyMsg_Add( job, done / (double)tiles_n, &t );
+  }
+}
+
+/* oyConversion_RunPixelsTiled() with optional job for progress and cancel */
+static int oyConversion_RunTiled_    ( oyConversion_s    * conversion,
+                                       oyPixelAccess_s   * pixel_access,
+                                       int                 tile_width,
+                                       int                 tile_height,
+                                       int                 threads,
+                                       oyJob_s           * job,
+                                       int                 serial )
+{
+  oyConversion_s_ * s = (oyConversion_s_*)conversion;
+  oyFilterPlug_s * plug = 0;
+  oyFilterNode_s * node_out = 0;
+  oyImage_s * image_out = 0;
+  oyPixelAccess_s * pattern = 0;
+  oyRectangle_s * region = 0;
+  oyRectangle_s_ * tiles = 0;
+  int error = 0, tiles_x = 0, tiles_y, tiles_n = 0, i, done = 0, canceled = 0;
+  double x0, y0, shift_x = 0, shift_y = 0, width, height, clck = 0;
+
+  oyCheckType__m( oyOBJECT_CONVERSION_S, return 1 )
+
+  node_out = oyConversion_GetNode( conversion, OY_OUTPUT );
+  plug = oyFilterNode_GetPlug( node_out, 0 );
+  image_out = oyConversion_GetImage( conversion, OY_OUTPUT );
+
+  if(!plug || !image_out)
+  {
+    WARNc1_S("graph incomplete [%d]", s ? oyObject_GetId( s->oy_ ) : -1)
+    oyImage_Release( &image_out );
+    oyFilterPlug_Release( &plug );
+    oyFilterNode_Release( &node_out );
+    return 1;
+  }
+
+  if(pixel_access)
+    pattern = oyPixelAccess_Copy( pixel_access, pixel_access->oy_ );
+  else
+    pattern = oyPixelAccess_Create( 0,0, plug, oyPIXEL_ACCESS_IMAGE, 0 );
+  if(!pattern)
+    error = 1;
+
+  /* obtain the output region in pixel */
+  if(error <= 0)
+  {
+    oyPixelAccess_SetArray( pattern, NULL, 0 );
+    error = oyPixelAccess_RoiToPixels( pattern, NULL, &region );
+    shift_x = OY_ROUND(oyPixelAccess_GetStart( pattern, 0 ) * oyImage_GetWidth( image_out ));
+    shift_y = OY_ROUND(oyPixelAccess_GetStart( pattern, 1 ) * oyImage_GetWidth( image_out ));
+  }
+  x0 = oyRectangle_GetGeo1( region, 0 );
+  y0 = oyRectangle_GetGeo1( region, 1 );
+  shift_x -= x0;
+  shift_y -= y0;
+  width = oyRectangle_GetGeo1( region, 2 );
+  height = oyRectangle_GetGeo1( region, 3 );
+  if(x0 + width > oyImage_GetWidth( image_out ))
+    width = oyImage_GetWidth( image_out ) - x0;
+  if(y0 + height > oyImage_GetHeight( image_out ))
+    height = oyImage_GetHeight( image_out ) - y0;
+
+  if(tile_width <= 0 || tile_width > width)
+    tile_width = width;
+  if(tile_height <= 0)
+    tile_height = 64;
+  if(tile_height > height)
+    tile_height = height;
+
+  if(error <= 0 && tile_width > 0 && tile_height > 0)
+  {
+    tiles_x = (width + tile_width - 1) / tile_width;
+    tiles_y = (height + tile_height - 1) / tile_height;
+    tiles_n = tiles_x * tiles_y;
+    oyAllocHelper_m_( tiles, oyRectangle_s_, tiles_n, 0, error = 1 );
+    if(error <= 0)
+    for(i = 0; i < tiles_n; ++i)
+    {
+      oyRectangle_s_ r = {oyOBJECT_RECTANGLE_S, 0,0,0, 0,0,0,0};
+      double x = x0 + (i % tiles_x) * tile_width,
+             y = y0 + (i / tiles_x) * tile_height;
+      memcpy( &tiles[i], &r, sizeof(oyRectangle_s_) );
+      oyRectangle_SetGeo( (oyRectangle_s*)&tiles[i], x, y,
+                          OY_MIN( tile_width, x0 + width - x ),
+                          OY_MIN( tile_height, y0 + height - y ) );
+    }
+  }
+
+  if(oy_debug) clck = oyClock();
+
+  if(error <= 0 && tiles_n && oyConversion_Canceled_( s, job, serial ))
+    canceled = 1;
+
+  /* The first tile resolves the graph serially. */
+  if(error <= 0 && tiles_n && !canceled)
+  {
+    error = oyConversion_RunTile_( node_out, plug, pattern, image_out,
+                                   &tiles[0], shift_x, shift_y );
+    if(error > 0 &&
+       oyOptions_FindString( (oyOptions_s*)oyPixelAccessPriv_m(pattern)->graph->options, "dirty", "true" ))
+    {
+      oyFilterGraph_s * graph = (oyFilterGraph_s*)oyPixelAccessPriv_m(pattern)->graph;
+      oyImage_s * image_input;
+
+      /* same as in oyConversion_RunPixels() */
+      oyFilterGraph_SetFromNode( graph, (oyFilterNode_s*)s->input, 0, 0 );
+      image_input = oyFilterPlug_ResolveImage( plug, (oyFilterSocket_s*)((oyFilterPlug_s_*)plug)->remote_socket_,
+                                               pattern );
+      oyImage_Release( &image_input );
+      oyFilterGraph_PrepareContexts( graph, 0 );
+      error = oyConversion_RunTile_( node_out, plug, pattern, image_out,
+                                     &tiles[0], shift_x, shift_y );
+    }
+    if(error <= 0)
+      oyConversion_JobProgress_( job, ++done, tiles_n, tiles_x );
+  }
+
+  if(error <= 0 && tiles_n > 1 && !canceled)
+  {
+    int tile_error = 0;
+#if defined(_OPENMP)
+    if(threads <= 0)
+      threads = omp_get_max_threads();
+#endif
+
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic) num_threads(threads) reduction(max:tile_error) if(threads != 1)
+#endif
+    for(i = 1; i < tiles_n; ++i)
+    {
+      int e = 0, stop;
+
+      /* skip the remaining tiles of a canceled job */
+#if defined(_OPENMP)
+#pragma omp atomic read
+#endif
+      stop = canceled;
+      if(!stop && oyConversion_Canceled_( s, job, serial ))
+      {
+        stop = 1;
+#if defined(_OPENMP)
+#pragma omp atomic write
+#endif
+        canceled = 1;
+      }
+      if(!stop)
+        e = oyConversion_RunTile_( node_out, plug, pattern, image_out,
+                                   &tiles[i], shift_x, shift_y );
+      if(e > tile_error)
+        tile_error = e;
+
+      if(job && e <= 0 && !stop)
+      {
+#if defined(_OPENMP)
+#pragma omp critical (oyConversion_RunTiled_)
+#endif
+        oyConversion_JobProgress_( job, ++done, tiles_n, tiles_x );
+      }
+    }
+
+    error = tile_error;
+  }
+
+  if(canceled && error <= 0)
+    error = -1;
+
+  if(oy_debug)
+  { clck = oyClock() - clck;
+    DBG_PROG4_S( "oyConversion_RunPixelsTiled(%d tiles %dx%d): %g",
+                 tiles_n, tile_width, tile_height, clck/1000000.0 );
+  }
+
+  if(tiles)
+    oyFree_m_( tiles );
+  oyRectangle_Release( &region );
+  oyPixelAccess_Release( &pattern );
+  oyImage_Release( &image_out );
+  oyFilterPlug_Release( &plug );
+  oyFilterNode_Release( &node_out );
+
+  return error;
+}
+
+typedef struct {
+  oyConversion_s    * conversion;
+  oyPixelAccess_s   * pixel_access;
+  int                 tile_width;
+  int                 tile_height;
+  int                 serial;          /**< compared to oyConversion_s_::async_canceled_ */
+} oyConversionJob_s_;
+
+static int oyConversion_JobRelease_  ( oyPointer         * ptr )
+{
+  oyConversionJob_s_ * j = (oyConversionJob_s_*) *ptr;
+
+  if(!j)
+    return 1;
+
+  oyConversion_Release( &j->conversion );
+  oyPixelAccess_Release( &j->pixel_access );
+  oyDeAllocateFunc_( j );
+  *ptr = NULL;
+
+  return 0;
+}
+
+/* oyJob_s::work of oyConversion_RunPixelsAsync() */
+static int oyConversion_RunJob_      ( oyJob_s           * job )
+{
+  oyConversionJob_s_ * j = (oyConversionJob_s_*) oyPointer_GetPointer(
+                                                 (oyPointer_s*)job->context );
+  if(!j)
+    return 1;
+
+  return oyConversion_RunTiled_( j->conversion, j->pixel_access,
+                                 j->tile_width, j->tile_height, 0,
+                                 job, j->serial );
+}
+
+/** Function  oyConversion_RunPixelsAsync
+ *  @memberof oyConversion_s
+ *  @brief    Process a pixel conversion graph in a background job
+ *
+ *  The conversion is processed like oyConversion_RunPixelsTiled() inside a
+ *  worker thread of the job queue, see @ref threads. The function returns
+ *  immediately. The caller provides a job from oyJob_New() with the
+ *  optional oyJob_s::cb_progress, oyJob_s::cb_progress_context and
+ *  oyJob_s::finish callbacks. oyJob_s::context and oyJob_s::work are set
+ *  here.
+ *
+ *  Progress is sent after each finished band of tiles. Call oyJobResult()
+ *  from the managing thread, usually the GUI thread, to receive the
+ *  progress and the final oyJob_s::finish() call. oyJob_s::status_work_return
+ *  holds then the result: 0 on success, -1 for a canceled job, else error.
+ *
+ *  oyConversion_Cancel() stops all jobs of the conversion, which are
+ *  started before. The remaining tiles are skipped. E.g. a image viewer can
+ *  abort a stale render, as soon as the user zooms again, and start a new
+ *  one. The conversion and pixel_access are referenced by the job. The
+ *  conversion shall not be processed by other calls until the job is
+ *  finished.
+ *
+ *  @code
+    oyJob_s * job = oyJob_New( 0 );
+    job->cb_progress = myProgress;
+    job->finish = myFinish;
+    oyConversion_RunPixelsAsync( conversion, NULL, 0, 64, &job );
+    // in the GUI idle loop
+    oyJobResult();
+    @endcode
+ *
+ *  @param[in,out] conversion          conversion object
+ *  @param[in]     pixel_access        optional pixel iterator configuration;
+ *                                     it is copied
+ *  @param[in]     tile_width          tile width in pixel; 0 means image width
+ *  @param[in]     tile_height         tile height in pixel; 0 selects a
+ *                                     default of 64 lines
+ *  @param[in,out] job                 the job; it is moved into the queue
+ *  @return                            the job ID or 0 for error
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/16
+ *  @since   2026/10/16 (Oyranos: 0.9.7)
+ */
+int                oyConversion_RunPixelsAsync (
+                                       oyConversion_s    * conversion,
+                                       oyPixelAccess_s   * pixel_access,
+                                       int                 tile_width,
+                                       int                 tile_height,
+                                       oyJob_s          ** job )
+{
+  oyConversion_s_ * s = (oyConversion_s_*)conversion;
+  oyConversionJob_s_ * j = NULL;
+  oyPointer_s * context = NULL;
+  int error = 0;
+
+  oyCheckType__m( oyOBJECT_CONVERSION_S, return 0 )
+
+  if(!job || !*job || (*job)->context || (*job)->work)
+  {
+    WARNc1_S( "need a oyJob_New() job without context and work [%d]",
+              oyObject_GetId( s->oy_ ) );
+    return 0;
+  }
+
+  oyAllocHelper_m_( j, oyConversionJob_s_, 1, 0, return 0 );
+
+  j->conversion = oyConversion_Copy( conversion, 0 );
+  if(pixel_access)
+    j->pixel_access = oyPixelAccess_Copy( pixel_access, pixel_access->oy_ );
+  j->tile_width = tile_width;
+  j->tile_height = tile_height;
+
+  oyObject_Lock( s->oy_, __FILE__, __LINE__ );
+  j->serial = ++s->async_serial_;
+  oyObject_UnLock( s->oy_, __FILE__, __LINE__ );
+
+  context = oyPointer_New( 0 );
+  error = oyPointer_Set( context, __FILE__, "oyConversionJob_s_", j,
+                         "oyConversion_RunPixelsAsync",
+                         oyConversion_JobRelease_ );
+  if(error > 0)
+  {
+    oyConversion_JobRelease_( (oyPointer*)&j );
+    oyPointer_Release( &context );
+    return 0;
+  }
+
+  (*job)->context = (oyStruct_s*) context;
+  (*job)->work = oyConversion_RunJob_;
+
+  return oyJob_Add( job, 0, 0 );
+}
+
+/** Function  oyConversion_RunPixelsBatch
+ *  @memberof oyConversion_s
+ *  @brief    Process many independent images with one prepared conversion
+ *
+ *  Each pair of inputs[i] and outputs[i] is converted like
+ *  oyConversion_RunPixels() would do after oyConversion_SetImages(). The
+ *  nodes, options and contexts of the conversion are reused. So many small
+ *  images with the same profiles and pixel layouts, e.g. thumbnails, avoid
+ *  the graph setup per image. The images can have different sizes.
+ *
+ *  For more than one thread each thread obtains its own graph. The graphs
+ *  are created with oyConversion_CreateBasicPixels() and the options of
+ *  the conversions color node. The contexts come then from the Oyranos
+ *  cache. This needs a conversion from oyConversion_CreateBasicPixels(),
+ *  i.e. root -> "icc_color" -> output. Other graphs, including three node
+ *  graphs with a different middle filter, are processed serially. Thread locking is expected to be
+ *  set up by oyThreadLockingSet(), like for oyConversion_RunPixelsTiled().
+ *
+ *  After the run the conversion is set back to its previous images.
+ *
+ *  @param[in,out] conversion          conversion object
+ *  @param[in]     count               number of image pairs
+ *  @param[in]     inputs              input images
+ *  @param[in,out] outputs             output images
+ *  @param[in]     threads             number of threads; 0 means default,
+ *                                     1 processes all images serially
+ *  @return                            0 on success, else the highest error
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/16
+ *  @since   2026/10/16 (Oyranos: 0.9.7)
+ */
+int                oyConversion_RunPixelsBatch (
+                                       oyConversion_s    * conversion,
+                                       int                 count,
+                                       oyImage_s        ** inputs,
+                                       oyImage_s        ** outputs,
+                                       int                 threads )
+{
+  oyConversion_s_ * s = (oyConversion_s_*)conversion;
+  oyConversion_s ** workers = NULL;
+  oyFilterNode_s * node_out = NULL, * node_icc = NULL, * node_in = NULL;
+  oyImage_s * old_in = NULL, * old_out = NULL;
+  int error = 0, i, workers_n = 1;
+
+  oyCheckType__m( oyOBJECT_CONVERSION_S, return 1 )
+
+  if(count <= 0 || !inputs || !outputs)
+    return -1;
+
+  old_in = oyConversion_GetImage( conversion, OY_INPUT );
+  old_out = oyConversion_GetImage( conversion, OY_OUTPUT );
+
+#if defined(_OPENMP)
+  if(threads <= 0)
+    threads = omp_get_max_threads();
+#endif
+  if(threads > count)
+    threads = count;
+
+  /* a basic graph is root -> icc -> output */
+  node_out = oyConversion_GetNode( conversion, OY_OUTPUT );
+  node_icc = oyFilterNode_GetPlugNode( node_out, 0 );
+  node_in = oyFilterNode_GetPlugNode( node_icc, 0 );
+  if(threads > 1 && node_in && node_in == (oyFilterNode_s*)s->input &&
+     oyFilterRegistrationMatch( oyFilterNode_GetRegistration( node_icc ),
+                                "//" OY_TYPE_STD "/icc_color", 0 ))
+  {
+    oyOptions_s * opts = oyFilterNode_GetOptions( node_icc, 0 );
+
+    oyAllocHelper_m_( workers, oyConversion_s*, threads, 0, error = 1 );
+    if(error <= 0)
+    {
+      workers[0] = oyConversion_Copy( conversion, NULL );
+      for(i = 1; i < threads; ++i)
+      {
+        workers[i] = oyConversion_CreateBasicPixels( inputs[i], outputs[i],
+                                                     opts, 0 );
+        if(!workers[i])
+          break;
+      }
+      workers_n = i;
+    }
+    oyOptions_Release( &opts );
+  }
+  oyFilterNode_Release( &node_in );
+  oyFilterNode_Release( &node_icc );
+  oyFilterNode_Release( &node_out );
+
+  if(workers_n <= 1)
+  {
+    for(i = 0; i < count; ++i)
+    {
+      int img_error = oyConversion_SetImages( conversion, inputs[i], outputs[i] );
+      if(img_error <= 0)
+        img_error = oyConversion_RunPixels( conversion, NULL );
+      if(img_error > error)
+        error = img_error;
+    }
+  } else
+  {
+    int img_error = 0;
+
+    /* The first image of each worker prepares its graph serially. */
+    for(i = 0; i < workers_n; ++i)
+    {
+      img_error = oyConversion_SetImages( workers[i], inputs[i], outputs[i] );
+      if(img_error <= 0)
+        img_error = oyConversion_RunPixels( workers[i], NULL );
+      if(img_error > error)
+        error = img_error;
+    }
+
+    img_error = 0;
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic) num_threads(workers_n) reduction(max:img_error)
+#endif
+    for(i = workers_n; i < count; ++i)
+    {
+      int e, w = 0;
+#if defined(_OPENMP)
+      w = omp_get_thread_num();
+#endif
+      e = oyConversion_SetImages( workers[w], inputs[i], outputs[i] );
+      if(e <= 0)
+        e = oyConversion_RunPixels( workers[w], NULL );
+      if(e > img_error)
+        img_error = e;
+    }
+    if(img_error > error)
+      error = img_error;
+  }
+
+  for(i = 0; i < workers_n && workers; ++i)
+    oyConversion_Release( &workers[i] );
+  if(workers)
+    oyDeAllocateFunc_( workers );
+
+  oyConversion_SetImages( conversion, old_in, old_out );
+  oyImage_Release( &old_in );
+  oyImage_Release( &old_out );
+
+  return error;
+}
+
+/** Function  oyConversion_RunPixelsDirty
+ *  @memberof oyConversion_s
+ *  @brief    Process only the changed pixels of a conversion graph
+ *
+ *  Interactive applications change often only a small part of a image.
+ *  The changed regions are marked with oyFilterNode_SetDirty() on the
+ *  changed node or with oyImage_AddDirty() directly on the output image.
+ *  This function computes only the dirty rectangles inside the requested
+ *  region through oyConversion_RunPixelsTiled(). The contexts of the
+ *  graph are reused as usual.
+ *
+ *  Rectangles, which are completely processed, are removed from the output
+ *  image. Rectangles, which reach outside the requested region, stay for
+ *  a later call.
+ *
+ *  @param[in,out] conversion          conversion object
+ *  @param[in]     pixel_access        optional pixel iterator configuration;
+ *                                     start selects the source position and
+ *                                     the ROI the output region
+ *  @param[in]     threads             number of threads; 0 means default
+ *  @return                            0 on success, -1 nothing was dirty,
+ *                                     else error
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/16
+ *  @since   2026/10/16 (Oyranos: 0.9.7)
+ */
+int                oyConversion_RunPixelsDirty (
+                                       oyConversion_s    * conversion,
+                                       oyPixelAccess_s   * pixel_access,
+                                       int                 threads )
+{
+  oyConversion_s_ * s = (oyConversion_s_*)conversion;
+  oyFilterPlug_s * plug = 0;
+  oyFilterNode_s * node_out = 0;
+  oyImage_s * image_out = 0;
+  oyPixelAccess_s * pattern = 0, * ticket = 0;
+  oyRectangle_s * region = 0, * dirty = 0, * roi = 0;
+  oyRectangle_s_ requested = {oyOBJECT_RECTANGLE_S, 0,0,0, 0,0,0,0};
+  oyRectangle_s_ r = {oyOBJECT_RECTANGLE_S, 0,0,0, 0,0,0,0};
+  char * done = 0;
+  int error = 0, n, i, width;
+  double shift_x = 0, shift_y = 0;
+
+  oyCheckType__m( oyOBJECT_CONVERSION_S, return 1 )
+
+  node_out = oyConversion_GetNode( conversion, OY_OUTPUT );
+  plug = oyFilterNode_GetPlug( node_out, 0 );
+  image_out = oyConversion_GetImage( conversion, OY_OUTPUT );
+  width = oyImage_GetWidth( image_out );
+
+  if(!plug || !image_out || !width)
+  {
+    WARNc1_S("graph incomplete [%d]", s ? oyObject_GetId( s->oy_ ) : -1)
+    error = 1;
+  }
+
+  n = oyImage_CountDirty( image_out );
+  if(error <= 0 && !n)
+    error = -1;
+
+  /* cached tiles might contain the old pixels */
+  if(error == 0 && s->tile_cache_)
+  {
+    oyObject_Lock( s->oy_, __FILE__, __LINE__ );
+    oyStructList_Clear( s->tile_cache_ );
+    oyObject_UnLock( s->oy_, __FILE__, __LINE__ );
+  }
+
+  if(error == 0)
+  {
+    if(pixel_access)
+      pattern = oyPixelAccess_Copy( pixel_access, pixel_access->oy_ );
+    else
+      pattern = oyPixelAccess_Create( 0,0, plug, oyPIXEL_ACCESS_IMAGE, 0 );
+    oyAllocHelper_m_( done, char, n, 0, error = 1 );
+    if(!pattern)
+      error = 1;
+  }
+
+  /* the requested region in pixel of the output image */
+  if(error == 0)
+  {
+    oyPixelAccess_SetArray( pattern, NULL, 0 );
+    error = oyPixelAccess_RoiToPixels( pattern, NULL, &region );
+    shift_x = OY_ROUND(oyPixelAccess_GetStart( pattern, 0 ) * width);
+    shift_y = OY_ROUND(oyPixelAccess_GetStart( pattern, 1 ) * width);
+    oyRectangle_SetGeo( (oyRectangle_s*)&requested, shift_x, shift_y,
+                        oyRectangle_GetGeo1( region, 2 ),
+                        oyRectangle_GetGeo1( region, 3 ) );
+    shift_x -= oyRectangle_GetGeo1( region, 0 );
+    shift_y -= oyRectangle_GetGeo1( region, 1 );
+  }
+
+  for(i = 0; error <= 0 && i < n; ++i)
+  {
+    dirty = oyImage_GetDirty( image_out, i );
+    oyRectangle_SetByRectangle( (oyRectangle_s*)&r, dirty );
+    oyRectangle_Trim( (oyRectangle_s*)&r, (oyRectangle_s*)&requested );
+
+    if(r.width > 0 && r.height > 0)
+    {
+      /* the ticket covers only the dirty part */
+      ticket = oyPixelAccess_Copy( pattern, pattern->oy_ );
+      done[i] = oyRectangle_IsEqual( (oyRectangle_s*)&r, dirty );
+      r.x -= shift_x;
+      r.y -= shift_y;
+      oyPixelAccess_PixelsToRoi( ticket, (oyRectangle_s*)&r, &roi );
+      error = oyPixelAccess_ChangeRectangle( ticket, (r.x + shift_x) / width,
+                                             (r.y + shift_y) / width, roi );
+      if(error <= 0)
+        error = oyConversion_RunTiled_( conversion, ticket, 0, 0, threads,
+                                        NULL, 0 );
+      if(error > 0)
+        done[i] = 0;
+      oyRectangle_Release( &roi );
+      oyPixelAccess_Release( &ticket );
+    }
+
+    oyRectangle_Release( &dirty );
+  }
+
+  /* forget the processed rectangles */
+  if(done)
+  {
+    for(i = n - 1; i >= 0; --i)
+      if(done[i])
+        oyStructList_ReleaseAt( oyImagePriv_m(image_out)->dirty_, i );
+    oyDeAllocateFunc_( done );
+  }
+
+  oyRectangle_Release( &region );
+  oyPixelAccess_Release( &pattern );
+  oyImage_Release( &image_out );
+  oyFilterPlug_Release( &plug );
+  oyFilterNode_Release( &node_out );
+
+  return error;
+}
+
+/** Function  oyConversion_RunPixelsTiled
+ *  @memberof oyConversion_s
+ *  @brief    Process a pixel conversion graph in tiles
+ *
+ *  The output region is split into tiles. Each tile obtains a derived
+ *  oyPixelAccess_s job ticket with its own array and the whole DAG runs
+ *  per tile. So all nodes, including image loading and the final copy into
+ *  the output image, are processed in parallel. Tiles are scheduled
+ *  dynamically, which means a idle thread picks up the next pending tile.
+ *
+ *  The first tile is processed alone. This lets oyConversion_RunPixels()
+ *  resolve the graph and prepare all contexts before the graph is shared
+ *  by the concurrent tickets. The remaining tiles do not modify the graph.
+ *  Thread locking is expected to be set up by oyThreadLockingSet(), which
+ *  happens e.g. with the first oyJob_Add() call.
+ *
+ *  The results are written into the output image of the conversion at the
+ *  position of the pixel_access ROI, like oyConversion_RunPixels() does.
+ *  A array inside pixel_access is not touched.
+ *
+ *  @par Streaming:
+ *  With tile_width = 0 and threads = 1 the tiles become full width bands,
+ *  which are processed strictly from top to bottom. Memory use is then
+ *  bound to the band size. Together with images created by
+ *  oyImage_CreateFromLines() the input is pulled and the output is pushed
+ *  band by band, without a full frame in memory.
+ *  @code
+    // convert 256 lines at once
+    error = oyConversion_RunPixelsTiled( conversion, NULL, 0, 256, 1 );
+    @endcode
+ *
+ *  @param[in,out] conversion          conversion object
+ *  @param[in]     pixel_access        optional pixel iterator configuration;
+ *                                     start selects the source position and
+ *                                     the ROI the output region
+ *  @param[in]     tile_width          tile width in pixel; 0 means image width
+ *  @param[in]     tile_height         tile height in pixel; 0 selects a
+ *                                     default of 64 lines
+ *  @param[in]     threads             number of threads; 0 means default,
+ *                                     1 processes all tiles serially
+ *  @return                            0 on success, else error
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/16
+ *  @since   2026/10/16 (Oyranos: 0.9.7)
+ */
+int                oyConversion_RunPixelsTiled (
+                                       oyConversion_s    * conversion,
+                                       oyPixelAccess_s   * pixel_access,
+                                       int                 tile_width,
+                                       int                 tile_height,
+                                       int                 threads )
+{
+  return oyConversion_RunTiled_( conversion, pixel_access,
+                                 tile_width, tile_height, threads, NULL, 0 );
+}
+
+/** Function  oyConversion_Set
+ *  @memberof oyConversion_s
+ *  @brief    Set input and output of a conversion graph
+ *
+ *  @param[in,out] conversion          conversion object
+ *  @param[in]     input               input node
+ *  @param[in]     output              output node
+ *  @return                            0 on success, else error
+ *
+ *  @version Oyranos: 0.1.10
+ *  @since   2009/03/05 (Oyranos: 0.1.10)
+ *  @date    2009/03/05
+ */
+int                oyConversion_Set  ( oyConversion_s    * conversion,
+                                       oyFilterNode_s    * input,
+                                       oyFilterNode_s    * output )
+{
+  oyConversion_s_ * s = (oyConversion_s_*)conversion;
+  int error = 0;
+
+  oyCheckType__m( oyOBJECT_CONVERSION_S, return 1 )
+
+  if(input)
+    s->input = (oyFilterNode_s_*)oyFilterNode_Copy(input,NULL);
+
+  if(output)
+    s->out_ = (oyFilterNode_s_*)oyFilterNode_Copy(output,NULL);
+
+  return error;
+}
+
+/** Function  oyConversion_SetImages
+ *  @memberof oyConversion_s
+ *  @brief    Exchange the input and output images of a conversion graph
+ *
+ *  The new images are placed into the input node and into the node in front
+ *  of the output node. That lets a prepared conversion be applied to other
+ *  buffers without building a new graph. The contexts of the nodes remain.
+ *  So the images need the same pixel layouts and profiles as the current
+ *  ones. The sizes can differ.
+ *
+ *  @param[in,out] conversion          conversion object
+ *  @param[in]     input               input image; NULL keeps the current
+ *  @param[in]     output              output image; NULL keeps the current
+ *  @return                            0 on success, else error
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/16
+ *  @since   2026/10/16 (Oyranos: 0.9.7)
+ */
+int                oyConversion_SetImages (
+                                       oyConversion_s    * conversion,
+                                       oyImage_s         * input,
+                                       oyImage_s         * output )
+{
+  oyConversion_s_ * s = (oyConversion_s_*)conversion;
+  oyImage_s * images[2] = {input, output},
+            * old = NULL;
+  oyFilterNode_s * nodes[2] = {NULL, NULL};
+  int error = 0, i;
+
+  oyCheckType__m( oyOBJECT_CONVERSION_S, return 1 )
+
+  nodes[0] = oyFilterNode_Copy( (oyFilterNode_s*)s->input, 0 );
+  nodes[1] = oyFilterNode_GetPlugNode( (oyFilterNode_s*)s->out_, 0 );
+
+  for(i = 0; i < 2 && error <= 0; ++i)
+  {
+    oyProfile_s * p_old, * p_new;
+
+    if(!images[i])
+      continue;
+
+    old = oyConversion_GetImage( conversion, i ? OY_OUTPUT : OY_INPUT );
+    if(old == images[i])
+    {
+      oyImage_Release( &old );
+      continue;
+    }
+
+    p_old = oyImage_GetProfile( old );
+    p_new = oyImage_GetProfile( images[i] );
+    if(!nodes[i] ||
+       (old && (oyImage_GetPixelLayout( old, oyLAYOUT ) !=
+                oyImage_GetPixelLayout( images[i], oyLAYOUT ) ||
+                !oyProfile_Equal( p_old, p_new ))))
+    {
+      WARNc2_S( "%s image does not fit: %s", i ? "output" : "input",
+                oyStruct_GetText( (oyStruct_s*)images[i], oyNAME_NICK, 0 ) );
+      error = 1;
+    }
+    oyProfile_Release( &p_old );
+    oyProfile_Release( &p_new );
+    oyImage_Release( &old );
+  }
+
+  for(i = 0; i < 2 && error <= 0; ++i)
+    if(images[i])
+      error = oyFilterNode_SetData( nodes[i], (oyStruct_s*)images[i], 0, 0 );
+
+  oyFilterNode_Release( &nodes[0] );
+  oyFilterNode_Release( &nodes[1] );
+
+  return error;
+}
+
+/** Function  oyConversion_SetStats
+ *  @memberof oyConversion_s
+ *  @brief    Switch execution counters of all graph nodes on or off
+ *
+ *  Counters cost a clock call and a node lock per oyFilterNode_Run().
+ *  Without counters only a pointer is checked. So they can be enabled in
+ *  production builds to see, which node dominates the processing time.
+ *  The counters are read with oyConversion_GetStats(). Enabling again
+ *  resets them. Nodes, which are added later to the graph, are not counted.
+ *
+ *  @param[in,out] conversion          conversion object
+ *  @param[in]     enable              1 - reset and count; 0 - stop counting
+ *  @return                            0 on success, else error
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/16
+ *  @since   2026/10/16 (Oyranos: 0.9.7)
+ */
+int                oyConversion_SetStats (
+                                       oyConversion_s    * conversion,
+                                       int                 enable )
+{
+  oyConversion_s_ * s = (oyConversion_s_*)conversion;
+  oyFilterGraph_s * graph;
+  int n, i, error = 0;
+
+  if(!s)
+    return 1;
+
+  oyCheckType__m( oyOBJECT_CONVERSION_S, return 1 )
+
+  /* libOyranosModules can not link to oyPixelAccess_RoiToPixels() */
+  if(enable)
+    oyFilterNode_RoiToPixels_p_ = oyPixelAccess_RoiToPixels;
+
+  graph = oyConversion_GetGraph( conversion );
+  n = oyFilterGraph_CountNodes( graph, "", NULL );
+
+  for(i = 0; i < n; ++i)
+  {
+    oyFilterNode_s_ * node = (oyFilterNode_s_*) oyFilterGraph_GetNode( graph,
+                                                             i, "", NULL );
+    oyObject_Lock( node->oy_, __FILE__, __LINE__ );
+    if(enable && !node->stats_)
+      oyStruct_AllocHelper_m_( node->stats_, oyFilterNodeStats_s_, 1, node,
+                               error = 1 );
+    if(enable && node->stats_)
+      memset( node->stats_, 0, sizeof(oyFilterNodeStats_s_) );
+    if(!enable && node->stats_)
+    {
+      node->oy_->deallocateFunc_( node->stats_ );
+      node->stats_ = NULL;
+    }
+    oyObject_UnLock( node->oy_, __FILE__, __LINE__ );
+    oyFilterNode_Release( (oyFilterNode_s**)&node );
+  }
+  oyFilterGraph_Release( &graph );
+
+  s->stats_tile_hits_ = 0;
+
+  return error;
+}
+
+/** Function  oyConversion_SetTileCache
+ *  @memberof oyConversion_s
+ *  @brief    Keep results of oyConversion_RunPixels() for revisited regions
+ *
+ *  Image viewers run the same conversion again, when the view scrolls back
+ *  to a region it has shown before. With a tile cache each result of
+ *  oyConversion_RunPixels() is kept in memory. The key is built from the
+ *  hash texts of all graph nodes, their data objects, the job tickets
+ *  start, ROI and array geometry and the output image size as scale. A
+ *  matching request is then served by a memory copy. The least recently
+ *  used tiles are dropped above the byte budget.
+ *
+ *  Changed options or images in the graph lead to new keys. Pixels, which
+ *  change inside a image, have to be marked with oyFilterNode_SetDirty()
+ *  or oyImage_AddDirty(), which drops all tiles on the next run. Calling
+ *  this function again drops all tiles as well.
+ *  @code
+    // keep up to 64 MiB of converted pixels
+    oyConversion_SetTileCache( conversion, 64 * 1024 * 1024 );
+    @endcode
+ *
+ *  @param[in,out] conversion          conversion object
+ *  @param[in]     bytes               memory budget; 0 disables the cache
+ *  @return                            0 on success, else error
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/16
+ *  @since   2026/10/16 (Oyranos: 0.9.7)
+ */
+int                oyConversion_SetTileCache (
+                                       oyConversion_s    * conversion,
+                                       size_t              bytes )
+{
+  oyConversion_s_ * s = (oyConversion_s_*)conversion;
+
+  if(!s)
+    return 1;
+
+  oyCheckType__m( oyOBJECT_CONVERSION_S, return 1 )
+
+  oyObject_Lock( s->oy_, __FILE__, __LINE__ );
+  oyStructList_Release( &s->tile_cache_ );
+  s->tile_cache_budget_ = bytes;
+  if(bytes)
+    s->tile_cache_ = oyStructList_New( 0 );
+  oyObject_UnLock( s->oy_, __FILE__, __LINE__ );
+
+  return 0;
 }
 
 /** Function  oyConversion_ToText
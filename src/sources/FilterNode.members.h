@@ -13,3 +13,4 @@
   oyPointer_s        * backend_data;
   /** the processing function and node connector descriptions */
   oyCMMapi7_s_       * api7_;
+  oyFilterNodeStats_s_ * stats_;      /**< @private counters, see oyConversion_SetStats() */
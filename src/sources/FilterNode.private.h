@@ -0,0 +1,31 @@
+/** @internal
+ *  @brief   execution counters of a node, see oyConversion_SetStats() */
+typedef struct {
+  int          calls;                  /**< oyFilterNode_Run() calls */
+  double       seconds;                /**< wall time including input nodes */
+  double       pixels;                 /**< pixels requested by the tickets */
+  double       bytes;                  /**< pixel arrays attached to tickets */
+  int          cache_hits;             /**< contexts from the Oyranos cache */
+  int          cache_misses;           /**< contexts created by a module */
+} oyFilterNodeStats_s_;
+
+/** @internal
+ *  @brief   first line of a device link disk cache file */
+#define OY_DL_DISK_CACHE_FORMAT "oyranos-device-link-cache 2"
+/** @internal
+ *  @brief   default bytes of the device link disk cache; see OY_DL_CACHE_SIZE */
+#define OY_DL_DISK_CACHE_SIZE (64 * 1024 * 1024)
+
+/** @internal
+ *  @brief   libOyranos functions used inside libOyranosModules
+ *
+ *  libOyranosModules does not link against libOyranos. oyImage_New()
+ *  registers oyImage_AddDirty() for oyFilterNode_SetDirty() and
+ *  oyConversion_SetStats() registers oyPixelAccess_RoiToPixels() for
+ *  oyFilterNode_RunStats_().
+ */
+extern int (*oyFilterNode_ImageAddDirty_p_) ( oyImage_s         * image,
+                                              oyRectangle_s     * pixels );
+extern int (*oyFilterNode_RoiToPixels_p_)   ( oyPixelAccess_s   * ticket,
+                                              oyRectangle_s     * roi,
+                                              oyRectangle_s    ** pixels );
@@ -101,6 +101,8 @@ void oyFilterNode_Release__Members( oyFilterNode_s_ * filternode )
     filternode->sockets = NULL;
     if(filternode->plugs) deallocateFunc(filternode->plugs);
     filternode->plugs = NULL;
+    if(filternode->stats_) deallocateFunc(filternode->stats_);
+    filternode->stats_ = NULL;
   }
 
   if(oy_debug_objects >= 0)
@@ -3,8 +3,22 @@ int  oyFilterNode_AddToAdjacencyLst_ ( oyFilterNode_s_    * s,
                                        oyFilterPlugs_s_   * edges,
                                        const char         * mark,
                                        int                  flags );
+int          oyFilterNode_RunStats_  ( oyFilterNode_s_    * node,
+                                       oyFilterPlug_s     * plug,
+                                       oyPixelAccess_s    * ticket );
+oyPointer    oyFilterNode_ContextFromDisk_ (
+                                       oyFilterNode_s_    * node,
+                                       const char         * hash_text,
+                                       size_t             * size );
+int          oyFilterNode_ContextToDisk_ (
+                                       oyFilterNode_s_    * node,
+                                       const char         * hash_text,
+                                       oyPointer            ptr,
+                                       size_t               size );
 int          oyFilterNode_SetContext_( oyFilterNode_s_    * node,
                                        oyBlob_s_          * blob );
+char *       oyFilterNode_GetHashText_(oyFilterNode_s_   * node,
+                                       int                 api );
 oyStructList_s * oyFilterNode_GetData_(oyFilterNode_s_    * node,
                                        int                  get_plug );
 oyFilterNode_s *   oyFilterNode_GetLastFromLinear_ (
@@ -361,6 +361,86 @@ int            oyFilterNode_SetData  ( oyFilterNode_s    * node,
   return 0;
 }
 
+/** Function  oyFilterNode_SetDirty
+ *  @memberof oyFilterNode_s
+ *  @brief    Mark a pixel region of a node as changed
+ *
+ *  The region is passed in direction of the data flow to the graph ends.
+ *  There it is added to the images with oyImage_AddDirty(). A following
+ *  oyConversion_RunPixelsDirty() computes only those pixels again.
+ *  Filters are assumed to work pixel wise, which is true for the
+ *  colour conversion nodes. Nodes, which mix neighbour pixels, should
+ *  mark a widened region.
+ *
+ *  @param[in]     node                the changed node, e.g. a input node
+ *                                     after new pixels were written
+ *  @param[in]     pixels              the region in pixel of the graphs
+ *                                     images; NULL marks all pixels
+ *  @return                            0 on success, else error
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/16
+ *  @since   2026/10/16 (Oyranos: 0.9.7)
+ */
+int            oyFilterNode_SetDirty ( oyFilterNode_s    * node,
+                                       oyRectangle_s     * pixels )
+{
+  oyFilterNode_s_ * s = (oyFilterNode_s_*)node;
+  oyFilterSocket_s_ * socket;
+  oyFilterPlug_s_ * p;
+  oyStruct_s * data;
+  int n, i, j, p_n, requested = 0, error = 0;
+
+  if(!s)
+    return 1;
+
+  oyCheckType__m( oyOBJECT_FILTER_NODE_S, return 1 );
+
+  /* follow the requesting plugs down stream */
+  n = oyFilterNode_EdgeCount( node, 0, 0 );
+  for( i = 0; i < n; ++i )
+  {
+    socket = (oyFilterSocket_s_*)s->sockets[i];
+    if(!socket || !socket->requesting_plugs_)
+      continue;
+
+    p_n = oyFilterPlugs_Count( socket->requesting_plugs_ );
+    for( j = 0; j < p_n; ++j )
+    {
+      p = (oyFilterPlug_s_*)oyFilterPlugs_Get( socket->requesting_plugs_, j );
+      if(p && p->node)
+      {
+        error = oyFilterNode_SetDirty( (oyFilterNode_s*)p->node, pixels );
+        ++requested;
+      }
+      oyFilterPlug_Release( (oyFilterPlug_s**)&p );
+      if(error > 0)
+        return error;
+    }
+  }
+
+  /* a graph end marks the images it reads */
+  if(!requested)
+  {
+    n = oyFilterNode_EdgeCount( node, 1, 0 );
+    for( i = 0; i < n; ++i )
+    {
+      p = (oyFilterPlug_s_*)s->plugs[i];
+      if(!p || !p->remote_socket_)
+        continue;
+
+      data = p->remote_socket_->data;
+      if(data && data->type_ == oyOBJECT_IMAGE_S &&
+         oyFilterNode_ImageAddDirty_p_)
+        error = oyFilterNode_ImageAddDirty_p_( (oyImage_s*)data, pixels );
+      if(error > 0)
+        return error;
+    }
+  }
+
+  return error;
+}
+
 /** Function  oyFilterNode_Disconnect
  *  @memberof oyFilterNode_s
  *  @brief    Disconnect two nodes by a edge
@@ -730,12 +810,15 @@ OYAPI int  OYEXPORT
 {
   oyFilterNode_s_ * s = (oyFilterNode_s_*)node;
   int error = 0;
+  double trace;
 
   if(!node)
     return -1;
 
   oyCheckType__m( oyOBJECT_FILTER_NODE_S, return 1 )
 
+  trace = oyTraceBegin();
+
 #if DEBUG
   if(oy_debug)
   {
@@ -751,7 +834,13 @@ OYAPI int  OYEXPORT
   }
 #endif
 
-  error = oyCMMapi7_Run( (oyCMMapi7_s*) s->api7_, plug, ticket );
+  if(s->stats_)
+    error = oyFilterNode_RunStats_( s, plug, ticket );
+  else
+    error = oyCMMapi7_Run( (oyCMMapi7_s*) s->api7_, plug, ticket );
+
+  if(trace)
+    oyTraceEnd( trace, oyFilterNode_GetRegistration( node ), "filter", -1 );
 
   return error;
 }
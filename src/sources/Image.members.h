@@ -24,3 +24,4 @@
   uint16_t             subsampling[2]; /**< 1, 2 or 4 */
   int                  sub_positioning;/**< 0 None, 1 Postscript, 2 CCIR 601-1*/
   oyStruct_s         * user_data;      /**< user provided pointer */
+  oyStructList_s     * dirty_;         /**< @private changed pixel rectangles, see oyImage_AddDirty() */
@@ -0,0 +1,2 @@
+/** dirty rectangles before oyImage_AddDirty() merges all into one */
+#define OY_IMAGE_DIRTY_MAX 16
@@ -1,3 +1,5 @@
+#include "oyFilterNode_s_.h"
+
 /** Function    oyImage_Release__Members
  *  @memberof   oyImage_s
  *  @brief      Custom Image destructor
@@ -30,6 +32,7 @@ void oyImage_Release__Members( oyImage_s_ * image )
 
   oyProfile_Release( &image->profile_ );
   oyOptions_Release( &image->tags );
+  oyStructList_Release( &image->dirty_ );
 
 
   if(image->oy_->deallocateFunc_)
@@ -64,6 +67,9 @@ void oyImage_Release__Members( oyImage_s_ * image )
  */
 int oyImage_Init__Members( oyImage_s_ * image )
 {
+  /* libOyranosModules can not link to oyImage_AddDirty() */
+  oyFilterNode_ImageAddDirty_p_ = oyImage_AddDirty;
+
   image->tags = oyOptions_New(0);
   image->layout_ = image->oy_->allocateFunc_( sizeof(oyPixel_t) * (oyCHAN0 + 
                                              4 + 1));
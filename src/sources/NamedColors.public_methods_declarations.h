@@ -11,4 +11,10 @@ void               oyNamedColors_SetSuffix (
 const char *       oyNamedColors_GetColorName (
                                        oyNamedColors_s   * colors,
                                        int                 pos );
-
+int                oyNamedColors_Convert (
+                                       oyNamedColors_s   * colors,
+                                       oyProfile_s       * profile,
+                                       oyPointer           buf,
+                                       oyDATATYPE_e        buf_type,
+                                       uint32_t            flags,
+                                       oyOptions_s       * options );
@@ -53,6 +53,21 @@ void oyProfile_Release__Members( oyProfile_s_ * profile )
 }
 
 
+/* serialisation for the create_profile disk cache in oyOptions_Handle() */
+static oyPointer oyProfile_ToMemForCache_ (
+                                       oyStruct_s        * profile,
+                                       size_t            * size,
+                                       oyAlloc_f           allocateFunc )
+{
+  return oyProfile_GetMem( (oyProfile_s*)profile, size, 0, allocateFunc );
+}
+static oyStruct_s * oyProfile_FromMemForCache_ (
+                                       size_t              size,
+                                       const oyPointer     mem )
+{
+  return (oyStruct_s*) oyProfile_FromMem( size, mem, 0, NULL );
+}
+
 /** @internal
  *  Function    oyProfile_Init__Members
  *  @memberof   oyProfile_s
@@ -73,6 +88,13 @@ int oyProfile_Init__Members( oyProfile_s_ * profile )
   profile->tags_ = oyStructList_Create( profile->type_, "oyProfileTag_s", 0 );
   profile->tags_modified_ = 0;
 
+  /* initialise the create_profile disk cache */
+  if(!oyProfile_ToMemForCache_p)
+  {
+    oyProfile_FromMemForCache_p = oyProfile_FromMemForCache_;
+    oyProfile_ToMemForCache_p = oyProfile_ToMemForCache_;
+  }
+
   return 0;
 }
 
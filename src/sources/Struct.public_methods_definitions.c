@@ -203,19 +203,29 @@ oyStruct_LockCreate_f   oyStruct_LockCreateFunc_ = oyStruct_LockCreateDummy_;
 oyLockRelease_f         oyLockReleaseFunc_ = oyLockReleaseDummy_;
 oyLock_f                oyLockFunc_        = oyLockDummy_;
 oyUnLock_f              oyUnLockFunc_      = oyUnLockDummy_;
+/* library wide lock for one time initialisations, see oyThreadLockingSet() */
+oyPointer               oy_struct_global_lock_ = NULL;
 
 /** Function: oyThreadLockingSet
  *  @ingroup threads
  *  @brief set locking functions for threaded applications
  *
- *  @since Oyranos: version 0.1.8
- *  @date  14 january 2008 (API 0.1.8)
+ *  A library wide lock is created with the new functions. It serialises
+ *  one time initialisations of global state.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/17
+ *  @since   2008/01/14 (Oyranos: 0.1.8)
  */
 void         oyThreadLockingSet        ( oyStruct_LockCreate_f  createLockFunc,
                                          oyLockRelease_f   releaseLockFunc,
                                          oyLock_f          lockFunc,
                                          oyUnLock_f        unlockFunc )
 {
+  if(oy_struct_global_lock_)
+    oyLockReleaseFunc_( oy_struct_global_lock_, __FILE__, __LINE__ );
+  oy_struct_global_lock_ = NULL;
+
   oyStruct_LockCreateFunc_ = createLockFunc;
   oyLockReleaseFunc_ = releaseLockFunc;
   oyLockFunc_ = lockFunc;
@@ -229,6 +239,8 @@ void         oyThreadLockingSet        ( oyStruct_LockCreate_f  createLockFunc,
     oyLockFunc_ = oyLockDummy_;
     oyUnLockFunc_ = oyUnLockDummy_;
   }
+
+  oy_struct_global_lock_ = oyStruct_LockCreateFunc_( NULL );
 }
 
 /**
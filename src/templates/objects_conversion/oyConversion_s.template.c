@@ -3,6 +3,7 @@
 {% block LocalIncludeFiles %}
 {{ block.super }}
 #include "oyranos_module_internal.h"
+#include "oyArray2d_s_.h"
 #include "oyCMMapiFilters_s.h"
 #include "oyFilterGraph_s.h"
 #include "oyFilterPlug_s_.h"
@@ -10,5 +11,6 @@
 #include "oyImage_s.h"
 #include "oyImage_s_.h"
 #include "oyCMMapi9_s_.h"
+#include "oyHash_s.h"
 #include "oyPixelAccess_s_.h"
 {% endblock %}
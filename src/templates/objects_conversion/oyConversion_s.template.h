@@ -8,4 +8,5 @@
 #include "oyProfile_s.h"
 #include "oyFilterNode_s.h"
 #include "oyPixelAccess_s.h"
+#include "oyranos_threads.h"
 {% endblock %}
@@ -4,6 +4,8 @@
 {{ block.super }}
 #include "oyFilterNode_s.h"
 #include "oyFilterNode_s_.h"
+#include "oyPixelAccess_s.h"
+#include "oyStructList_s.h"
 {% endblock %}
 
 {% block ChildMembers %}
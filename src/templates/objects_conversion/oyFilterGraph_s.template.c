@@ -7,4 +7,5 @@
 #include "oyCMMapi7_s_.h"
 #include "oyFilterNode_s_.h"
 #include "oyFilterPlug_s_.h"
+#include "oyranos_threads.h"
 {% endblock %}
@@ -15,4 +15,6 @@
 #include "oyCMMapi9_s_.h"
 #include "oyCMMapiFilters_s.h"
 #include "oyPointer_s_.h"
+#include "oyImage_s.h"
+#include "oyranos_threads.h"
 {% endblock %}
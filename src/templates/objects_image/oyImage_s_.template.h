@@ -5,6 +5,7 @@
 #include "oyranos_image.h"
 #include "oyRectangle_s.h"
 #include "oyProfile_s.h"
+#include "oyStructList_s.h"
 {% endblock %}
 
 {% block ChildMembers %}
@@ -1 +1,6 @@
 {% extends "Base_s.c" %}
+
+{% block LocalIncludeFiles %}
+{{ block.super }}
+#include "oyranos_module_internal.h"
+{% endblock %}
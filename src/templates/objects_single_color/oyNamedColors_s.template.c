@@ -1 +1,6 @@
 {% extends "oyList_s.template.c" %}
+
+{% block LocalIncludeFiles %}
+{{ block.super }}
+#include "oyranos_alpha_internal.h"
+{% endblock %}
@@ -11,6 +11,7 @@
 #include "oyranos_generic_internal.h"
 #include "oyranos_module_internal.h"
 #include "oyObject_s.h"
+#include "oyCMMapi_s_.h"
 #include "oyCMMapi3_s.h"
 #include "oyCMMapi4_s_.h"
 #include "oyCMMapi5_s.h"
@@ -21,8 +22,19 @@
 #include "oyCMMapiFilters_s.h"
 #include "oyCMMapiFilters_s_.h"
 #include "oyCMMapis_s.h"
+#include "oyHash_s.h"
+#include "oyOption_s_.h"
 #include "oyOptions_s_.h"
 #include "oyStructList_s_.h"
+#include "oyranos_version.h"
+
+#if defined(_WIN32)
+# include <process.h>  /* _getpid() */
+# include <sys/utime.h>
+#else
+# include <unistd.h>   /* getpid() */
+# include <utime.h>
+#endif
 
 /* defined in sources/Struct.public_methods_definitions.c */
 /** @internal
@@ -638,22 +650,60 @@ oyCMMapi_s *     oyCMMsGetApi_       ( oyOBJECT_e          type,
 }
 
 
+/* Create a global cache list together with its lock once. Threads, like
+ * the ones of oyFilterGraph_PrepareContexts(), can arrive here at the same
+ * time. So the list is created under the library wide lock and published
+ * only after its object lock exists. */
+static oyStructList_s * oyCacheListInit_ ( oyStructList_s   ** list,
+                                       const char        * name )
+{
+  if(!*list)
+  {
+    oyLockFunc_( oy_struct_global_lock_, __func__, __LINE__ );
+    if(!*list)
+    {
+      oyStructList_s * l = oyStructList_Create( 0, name, 0 );
+      oyObject_Lock( l->oy_, __FILE__, __LINE__ );
+      oyObject_UnLock( l->oy_, __FILE__, __LINE__ );
+      *list = l;
+    }
+    oyUnLockFunc_( oy_struct_global_lock_, __func__, __LINE__ );
+  }
+
+  return *list;
+}
+
 /** @internal
  *  @brief get always a Oyranos cache entry from the CMM's cache
  *
+ *  The list is locked during the search, so concurrent callers obtain the
+ *  same entry for the same hash_text. The entry lock is created inside that
+ *  section as well and can be used to guard filling the entry. The list and
+ *  its lock are created once under the library wide lock.
  *
- *  @since Oyranos: version 0.1.8
- *  @date  november 2007 (API 0.1.8)
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/17
+ *  @since   2007/11/00 (Oyranos: 0.1.8)
  */
 oyHash_s *   oyCMMCacheListGetEntry_ ( const char        * hash_text)
 {
-  if(!oy_cmm_cache_)
-    oy_cmm_cache_ = oyStructList_Create( 0, "oy_cmm_cache_", 0 );
+  oyHash_s * entry;
+
+  oyCacheListInit_( &oy_cmm_cache_, "oy_cmm_cache_" );
 
   if(oy_debug > 3)
     DBGs1_S(oy_cmm_cache_,"%s", hash_text)
 
-  return oyCacheListGetEntry_(oy_cmm_cache_, 0, hash_text);
+  oyObject_Lock( oy_cmm_cache_->oy_, __FILE__, __LINE__ );
+  entry = oyCacheListGetEntry_(oy_cmm_cache_, 0, hash_text);
+  if(entry)
+  {
+    oyObject_Lock( entry->oy_, __FILE__, __LINE__ );
+    oyObject_UnLock( entry->oy_, __FILE__, __LINE__ );
+  }
+  oyObject_UnLock( oy_cmm_cache_->oy_, __FILE__, __LINE__ );
+
+  return entry;
 }
 
 /** @internal
@@ -1872,9 +1922,9 @@ oyPointer_s  * oyPointer_LookUpFromObject (
  *  @return                             the CMM specific oyPointer_s; It is owned
  *                                      by the CMM.
  *
- *  @version Oyranos: 0.1.10
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/17
  *  @since   2009/11/05 (Oyranos: 0.1.10)
- *  @date    2009/11/05
  */
 oyPointer_s * oyPointer_LookUpFromText( const char        * text,
                                        const char        * data_type )
@@ -1910,8 +1960,11 @@ oyPointer_s * oyPointer_LookUpFromText( const char        * text,
     /* 2. query in cache */
     entry = oyCMMCacheListGetEntry_( hash_text );
 
-    if(error <= 0)
+    if(error <= 0 && entry)
     {
+      /* serialise concurrent filling of the same entry */
+      oyObject_Lock( entry->oy_, __FILE__, __LINE__ );
+
       /* 3. check and 3.a take*/
       cmm_ptr = (oyPointer_s*) oyHash_GetPointer( entry,
                                                   oyOBJECT_POINTER_S);
@@ -1926,10 +1979,17 @@ oyPointer_s * oyPointer_LookUpFromText( const char        * text,
                                  data_type, 0, 0, 0 );
 
         if(error <= 0 && cmm_ptr)
+        {
+          /* the module locks cmm_ptr while opening; create that lock here */
+          oyObject_Lock( cmm_ptr->oy_, __FILE__, __LINE__ );
+          oyObject_UnLock( cmm_ptr->oy_, __FILE__, __LINE__ );
           /* 3b.1. update cache entry */
           error = oyHash_SetPointer( entry,
                                      (oyStruct_s*) cmm_ptr );
+        }
       }
+
+      oyObject_UnLock( entry->oy_, __FILE__, __LINE__ );
     }
 
     oyHash_Release( &entry );
@@ -1939,6 +1999,506 @@ oyPointer_s * oyPointer_LookUpFromText( const char        * text,
 }
 
 
+/** @internal
+ *  @brief   identify a module build for disk cache files
+ *
+ *  The text contains the registration, the module version, the module API
+ *  version and the backend version of api. A cache file written with a
+ *  different text belongs to a other module build and shall be ignored.
+ *
+ *  @param[in]     api                 the module API
+ *  @return                            the text, one item per line
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/17
+ *  @since   2026/10/17 (Oyranos: 0.9.7)
+ */
+char *       oyCMMapiCacheId_        ( oyCMMapi_s        * api )
+{
+  oyCMMapi_s_ * s = (oyCMMapi_s_*)api;
+  oyCMMinfo_s * info = NULL;
+  char * text = NULL;
+
+  if(!s)
+    return NULL;
+
+  if(s->id_)
+    info = oyCMMinfoFromLibName_p( s->id_ );
+
+  oyStringAddPrintf_( &text, oyAllocateFunc_, oyDeAllocateFunc_,
+                      "%s\n%d.%d.%d %d.%d.%d %s\n",
+                      oyNoEmptyString_m_(s->registration),
+                      s->version[0], s->version[1], s->version[2],
+                      s->module_api[0], s->module_api[1], s->module_api[2],
+                      info ? oyNoEmptyString_m_(oyCMMinfo_GetVersion( info ))
+                           : "---" );
+  oyCMMinfo_Release( &info );
+
+  return text;
+}
+
+/* create_profile results kept in memory */
+#define OY_PROFILE_CACHE_ENTRIES 32
+#define OY_PROFILE_DISK_CACHE_FORMAT "oyranos-create-profile-cache 2"
+
+/** @internal
+ *  @brief   remove the least recently used files of a cache directory
+ *
+ *  Files are removed, oldest modification time first, until the files
+ *  ending with suffix fit into limit bytes. Other files in the directory
+ *  are neither counted nor touched. Temporary files from concurrent
+ *  writers are kept.
+ *
+ *  @param[in]     dir_name            unresolved directory, e.g.
+ *                                     OS_DL_CACHE_USER_DIR
+ *  @param[in]     suffix              file name ending, e.g. ".icc.cache"
+ *  @param[in]     limit               size in bytes
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/17
+ *  @since   2026/10/16 (Oyranos: 0.9.7)
+ */
+void         oyCacheDirTrim_         ( const char        * dir_name,
+                                       const char        * suffix,
+                                       size_t              limit )
+{
+  char * dir = oyResolveDirFileName_( dir_name );
+  char ** files = NULL;
+  int n = 0, i, suffix_len = suffix ? strlen( suffix ) : 0;
+  double total = 0;
+  struct stat * st = NULL;
+
+  if(dir)
+    files = oyGetFiles_( dir, &n );
+  if(n)
+    oyAllocHelper_m_( st, struct stat, n, oyAllocateFunc_, n = 0 );
+
+  for(i = 0; i < n; ++i)
+  {
+    int len = strlen( files[i] );
+    /* skip foreign files and files written by others right now */
+    if((suffix && (len < suffix_len ||
+                   strcmp( files[i] + len - suffix_len, suffix ) != 0)) ||
+       stat( files[i], &st[i] ) != 0 || strstr( files[i], ".tmp" ))
+      st[i].st_size = -1;
+    else
+      total += st[i].st_size;
+  }
+
+  while(total > limit)
+  {
+    int oldest = -1;
+    for(i = 0; i < n; ++i)
+      if(st[i].st_size >= 0 &&
+         (oldest < 0 || st[i].st_mtime < st[oldest].st_mtime))
+        oldest = i;
+    if(oldest < 0)
+      break;
+
+    if(oy_debug)
+      oyMessageFunc_p( oyMSG_DBG, NULL, OY_DBG_FORMAT_
+                       "remove from disk cache: %s", OY_DBG_ARGS_,
+                       files[oldest] );
+    oyRemoveFile_( files[oldest] );
+    total -= st[oldest].st_size;
+    st[oldest].st_size = -1;
+  }
+
+  if(st)
+    oyFree_m_( st );
+  oyStringListRelease_( &files, n, oyDeAllocateFunc_ );
+  if(dir)
+    oyFree_m_( dir );
+}
+
+/* bytes of the create_profile disk cache; it is off unless
+ * OY_PROFILE_CACHE_SIZE asks for it */
+static size_t oyOptions_HandleCacheLimit_( void )
+{
+  const char * env = getenv( "OY_PROFILE_CACHE_SIZE" );
+
+  if(env)
+    return (size_t) strtoul( env, NULL, 10 );
+
+  return 0;
+}
+
+/* lookup text from registration, command and all input values;
+ * NULL for commands other than create_profile or for anonymous objects */
+static char *  oyOptions_HandleCacheKey_ (
+                                       const char        * registration,
+                                       oyOptions_s       * options,
+                                       const char        * command )
+{
+  char * key = NULL;
+  int n = oyOptions_Count( options ), i, j, count, cacheable = 1;
+
+  if(!command || strncmp( command, "create_profile", 14 ) != 0)
+    return NULL;
+
+  oyStringAddPrintf_( &key, oyAllocateFunc_, oyDeAllocateFunc_,
+                      "%s\n%s\n", oyNoEmptyString_m_(registration), command );
+
+  for(i = 0; i < n && cacheable; ++i)
+  {
+    oyOption_s_ * o = (oyOption_s_*) oyOptions_Get( options, i );
+    oyValue_u * v = o->value;
+
+    oyStringAddPrintf_( &key, oyAllocateFunc_, oyDeAllocateFunc_,
+                        "%s[%d]=", o->registration, o->value_type );
+    if(v)
+    switch(o->value_type)
+    {
+    case oyVAL_INT:
+         oyStringAddPrintf_( &key, oyAllocateFunc_, oyDeAllocateFunc_,
+                             "%d", v->int32 );
+         break;
+    case oyVAL_INT_LIST:
+         for(j = 0; j < v->int32_list[0]; ++j)
+           oyStringAddPrintf_( &key, oyAllocateFunc_, oyDeAllocateFunc_,
+                               "%d,", v->int32_list[j+1] );
+         break;
+    /* %g would drop digits of nearby values */
+    case oyVAL_DOUBLE:
+         oyStringAddPrintf_( &key, oyAllocateFunc_, oyDeAllocateFunc_,
+                             "%.17g", v->dbl );
+         break;
+    case oyVAL_DOUBLE_LIST:
+         count = (int)v->dbl_list[0];
+         for(j = 0; j < count; ++j)
+           oyStringAddPrintf_( &key, oyAllocateFunc_, oyDeAllocateFunc_,
+                               "%.17g,", v->dbl_list[j+1] );
+         break;
+    case oyVAL_STRING:
+         oyStringAddPrintf_( &key, oyAllocateFunc_, oyDeAllocateFunc_,
+                             "%s", oyNoEmptyString_m_(v->string) );
+         break;
+    case oyVAL_STRING_LIST:
+         for(j = 0; v->string_list && v->string_list[j]; ++j)
+           oyStringAddPrintf_( &key, oyAllocateFunc_, oyDeAllocateFunc_,
+                               "%s,", v->string_list[j] );
+         break;
+    case oyVAL_STRUCT:
+         {
+           /* objects need a identifying text, like the profile hash */
+           const char * id = v->oy_struct ?
+                         oyStruct_GetText( v->oy_struct, oyNAME_NICK, 0 ) : 0;
+           if(id && id[0] &&
+              strcmp( id, oyStructTypeToText( v->oy_struct->type_ ) ) != 0)
+             oyStringAddPrintf_( &key, oyAllocateFunc_, oyDeAllocateFunc_,
+                                 "%s", id );
+           else
+             cacheable = 0;
+         }
+         break;
+    case oyVAL_NONE:
+    case oyVAL_MAX:
+         break;
+    }
+    STRING_ADD( key, "\n" );
+
+    oyOption_Release( (oyOption_s**)&o );
+  }
+
+  if(!cacheable)
+    oyFree_m_( key );
+
+  return key;
+}
+
+/* file name of a result inside the create_profile disk cache */
+static char *  oyOptions_HandleCacheName_ (
+                                       const char        * key )
+{
+  unsigned char md5[16] = {0};
+  char * dir, * name = NULL;
+  int i;
+
+  dir = oyResolveDirFileName_( OS_PROFILE_CACHE_USER_DIR );
+  if(!dir)
+    return NULL;
+
+  oyMiscBlobGetMD5_( key, strlen(key), md5 );
+  oyStringAddPrintf_( &name, oyAllocateFunc_, oyDeAllocateFunc_,
+                      "%s" OY_SLASH, dir );
+  for(i = 0; i < 16; ++i)
+    oyStringAddPrintf_( &name, oyAllocateFunc_, oyDeAllocateFunc_,
+                        "%02x", md5[i] );
+  STRING_ADD( name, ".icc.cache" );
+  oyFree_m_( dir );
+
+  return name;
+}
+
+/* file header without the option and sizes lines; bound to the Oyranos
+ * version and to the handling module build by oyCMMapiCacheId_() */
+static char *  oyOptions_HandleCacheHeader_ (
+                                       const char        * module )
+{
+  char * header = NULL;
+
+  oyStringAddPrintf_( &header, oyAllocateFunc_, oyDeAllocateFunc_,
+                      OY_PROFILE_DISK_CACHE_FORMAT "\n%s\n%s",
+                      OYRANOS_VERSION_NAME, oyNoEmptyString_m_(module) );
+  return header;
+}
+
+/* read a single profile result written by oyOptions_HandleCacheToDisk_() */
+static oyOptions_s * oyOptions_HandleCacheFromDisk_ (
+                                       const char        * key,
+                                       const char        * module )
+{
+  char * file_name, * header = NULL, * mem = NULL, * option_reg = NULL;
+  size_t mem_size = 0, header_len;
+  unsigned long text_len = 0, blob_size = 0;
+  oyOptions_s * result = NULL;
+
+  if(!oyProfile_FromMemForCache_p || !oyOptions_HandleCacheLimit_())
+    return NULL;
+
+  file_name = oyOptions_HandleCacheName_( key );
+  if(!file_name || !oyIsFile_( file_name ))
+  {
+    if(file_name)
+      oyFree_m_( file_name );
+    return NULL;
+  }
+
+  header = oyOptions_HandleCacheHeader_( module );
+  header_len = strlen( header );
+  mem = oyReadFileToMem_( file_name, &mem_size, oyAllocateFunc_ );
+
+  /* header, option registration, sizes, key, profile */
+  if(mem && mem_size > header_len &&
+     memcmp( mem, header, header_len ) == 0)
+  {
+    const char * reg = mem + header_len,
+               * sizes = memchr( reg, '\n', mem_size - header_len ),
+               * data = NULL;
+    if(sizes++ &&
+       sscanf( sizes, "%lu %lu", &text_len, &blob_size ) == 2)
+      data = memchr( sizes, '\n', mem_size - (sizes - mem) );
+    if(data++ &&
+       (size_t)(data - mem) + text_len + blob_size == mem_size &&
+       text_len == strlen( key ) &&
+       memcmp( data, key, text_len ) == 0)
+    {
+      oyStruct_s * profile = oyProfile_FromMemForCache_p( blob_size,
+                                                  (oyPointer)(data + text_len) );
+      option_reg = oyStringCopy_( reg, oyAllocateFunc_ );
+      option_reg[sizes - 1 - reg] = '\000';
+      if(profile)
+        oyOptions_MoveInStruct( &result, option_reg, &profile, OY_CREATE_NEW );
+      oyFree_m_( option_reg );
+    }
+  }
+
+  if(result)
+    /* mark as recently used */
+    utime( file_name, NULL );
+  else if(mem)
+    /* outdated or broken */
+    oyRemoveFile_( file_name );
+
+  if(oy_debug)
+    oyMessageFunc_p( oyMSG_DBG, NULL, OY_DBG_FORMAT_
+                     "%s disk cache: %s", OY_DBG_ARGS_,
+                     result ? "found in" : "removed from", file_name );
+
+  if(mem)
+    oyFree_m_( mem );
+  oyFree_m_( header );
+  oyFree_m_( file_name );
+
+  return result;
+}
+
+/* write a result consisting of a single profile option */
+static int     oyOptions_HandleCacheToDisk_ (
+                                       const char        * key,
+                                       oyOptions_s       * result,
+                                       const char        * module )
+{
+  size_t limit = oyOptions_HandleCacheLimit_(), size = 0, text_len,
+         header_len;
+  char * file_name = NULL, * tmp_name = NULL, * header = NULL, * mem = NULL;
+  oyOption_s_ * o = NULL;
+  oyPointer blob = NULL;
+  int error = 0;
+
+  if(!oyProfile_ToMemForCache_p || !limit || oyOptions_Count( result ) != 1)
+    return -1;
+
+  o = (oyOption_s_*) oyOptions_Get( result, 0 );
+  if(o->value_type == oyVAL_STRUCT && o->value && o->value->oy_struct &&
+     o->value->oy_struct->type_ == oyOBJECT_PROFILE_S)
+    blob = oyProfile_ToMemForCache_p( o->value->oy_struct, &size,
+                                      oyAllocateFunc_ );
+  if(!blob || !size || size > limit)
+    error = -1;
+
+  if(!error)
+  {
+    file_name = oyOptions_HandleCacheName_( key );
+    error = !file_name;
+  }
+
+  if(!error)
+  {
+    text_len = strlen( key );
+    header = oyOptions_HandleCacheHeader_( module );
+    oyStringAddPrintf_( &header, oyAllocateFunc_, oyDeAllocateFunc_,
+                        "%s\n%lu %lu\n", o->registration,
+                        (unsigned long)text_len, (unsigned long)size );
+    header_len = strlen( header );
+
+    mem = oyAllocateFunc_( header_len + text_len + size );
+    error = !mem;
+  }
+
+  if(!error)
+  {
+    memcpy( mem, header, header_len );
+    memcpy( mem + header_len, key, text_len );
+    memcpy( mem + header_len + text_len, blob, size );
+
+    oyStringAddPrintf_( &tmp_name, oyAllocateFunc_, oyDeAllocateFunc_,
+                        "%s.%d-%d.tmp", file_name, (int)OY_GETPID(),
+                        oyObject_GetId( o->oy_ ) );
+    error = oyWriteMemToFile_( tmp_name, mem, header_len + text_len + size );
+#if defined(_WIN32)
+    if(!error)
+      oyRemoveFile_( file_name );
+#endif
+    if(!error)
+      error = rename( tmp_name, file_name );
+    if(error)
+      oyRemoveFile_( tmp_name );
+    oyFree_m_( tmp_name );
+    oyFree_m_( mem );
+  }
+
+  if(!error)
+    oyCacheDirTrim_( OS_PROFILE_CACHE_USER_DIR, ".icc.cache", limit );
+
+  if(oy_debug && file_name)
+    oyMessageFunc_p( oyMSG_DBG, NULL, OY_DBG_FORMAT_
+                     "wrote %s to disk cache: %d", OY_DBG_ARGS_,
+                     file_name, error );
+
+  if(blob)
+    oyFree_m_( blob );
+  if(header)
+    oyFree_m_( header );
+  if(file_name)
+    oyFree_m_( file_name );
+  oyOption_Release( (oyOption_s**)&o );
+
+  return error;
+}
+
+/* store in memory, drop the least recently used entries beyond
+ * OY_PROFILE_CACHE_ENTRIES and keep a profile result of module on disk */
+static void    oyOptions_HandleCachePut_ (
+                                       const char        * key,
+                                       oyOptions_s       * result,
+                                       const char        * module )
+{
+  oyHash_s * hash;
+  int n;
+
+  oyCacheListInit_( &oy_create_profile_cache_, "oy_create_profile_cache_" );
+
+  oyObject_Lock( oy_create_profile_cache_->oy_, __FILE__, __LINE__ );
+  hash = oyCacheListGetEntry_( oy_create_profile_cache_, 0, key );
+  /* a concurrent caller might have been faster */
+  if(!oyHash_GetPointer( hash, oyOBJECT_OPTIONS_S ))
+    oyHash_SetPointer( hash, (oyStruct_s*)result );
+  oyHash_Release( &hash );
+  n = oyStructList_Count( oy_create_profile_cache_ );
+  while(n-- > OY_PROFILE_CACHE_ENTRIES)
+    oyStructList_ReleaseAt( oy_create_profile_cache_, 0 );
+  oyObject_UnLock( oy_create_profile_cache_->oy_, __FILE__, __LINE__ );
+
+  if(module)
+    oyOptions_HandleCacheToDisk_( key, result, module );
+}
+
+/* memory tier; a hit becomes the most recently used entry */
+static oyOptions_s * oyOptions_HandleCacheGet_ (
+                                       const char        * key )
+{
+  oyHash_s * hash, * entry;
+  oyOptions_s * result;
+  int n, i;
+
+  oyCacheListInit_( &oy_create_profile_cache_, "oy_create_profile_cache_" );
+
+  oyObject_Lock( oy_create_profile_cache_->oy_, __FILE__, __LINE__ );
+  hash = oyCacheListGetEntry_( oy_create_profile_cache_, 0, key );
+  result = (oyOptions_s*) oyHash_GetPointer( hash, oyOBJECT_OPTIONS_S );
+  n = oyStructList_Count( oy_create_profile_cache_ );
+  if(result)
+  {
+    result = oyOptions_Copy( result, NULL );
+    for(i = 0; i < n - 1; ++i)
+    {
+      entry = (oyHash_s*) oyStructList_GetRefType( oy_create_profile_cache_,
+                                                   i, oyOBJECT_HASH_S );
+      if(entry == hash)
+      {
+        oyStructList_ReleaseAt( oy_create_profile_cache_, i );
+        oyStructList_MoveIn( oy_create_profile_cache_, (oyStruct_s**)&entry,
+                             -1, 0 );
+        break;
+      }
+      oyHash_Release( &entry );
+    }
+  }
+  oyHash_Release( &hash );
+  oyObject_UnLock( oy_create_profile_cache_->oy_, __FILE__, __LINE__ );
+
+  return result;
+}
+
+/* hand out a cached result; profiles are written to memory and parsed
+ * again, so callers can not change the cached objects */
+static void    oyOptions_HandleCacheResult_ (
+                                       oyOptions_s       * cached,
+                                       oyOptions_s      ** result )
+{
+  int n = oyOptions_Count( cached ), i;
+
+  if(!*result)
+    *result = oyOptions_New( 0 );
+
+  for(i = 0; i < n; ++i)
+  {
+    oyOption_s_ * o = (oyOption_s_*) oyOptions_Get( cached, i );
+    oyStruct_s * profile = NULL;
+
+    if(o->value_type == oyVAL_STRUCT && o->value && o->value->oy_struct &&
+       o->value->oy_struct->type_ == oyOBJECT_PROFILE_S &&
+       oyProfile_ToMemForCache_p && oyProfile_FromMemForCache_p)
+    {
+      size_t size = 0;
+      oyPointer mem = oyProfile_ToMemForCache_p( o->value->oy_struct, &size,
+                                                 oyAllocateFunc_ );
+      if(mem && size)
+        profile = oyProfile_FromMemForCache_p( size, mem );
+      if(mem)
+        oyFree_m_( mem );
+    }
+
+    if(profile)
+      oyOptions_MoveInStruct( result, o->registration, &profile,
+                              OY_CREATE_NEW );
+    else
+      oyOptions_Set( *result, (oyOption_s*)o, -1, (*result)->oy_ );
+    oyOption_Release( (oyOption_s**)&o );
+  }
+}
+
 /** 
  *  @brief    Handle a request by a module
  *  @memberof oyOptions_s
@@ -1951,8 +2511,15 @@ oyPointer_s * oyPointer_LookUpFromText( const char        * text,
  *                                     <= -1 - issue,
  *                                     + a message should be sent
  *
- *  @version  Oyranos: 0.9.0
- *  @date     2012/10/25
+ *  The results of "create_profile" commands are cached in memory. The
+ *  lookup key consists of the registration, command and the input option
+ *  values. Callers obtain copies of cached profiles. Setting the
+ *  OY_PROFILE_CACHE_SIZE environment variable to a size in bytes keeps
+ *  single profile results additionally on disk, bound to the version of the
+ *  handling module.
+ *
+ *  @version  Oyranos: 0.9.7
+ *  @date     2026/10/17
  *  @since    2009/12/11 (Oyranos: 0.1.10)
  */
 int             oyOptions_Handle     ( const char        * registration,
@@ -1960,18 +2527,37 @@ int             oyOptions_Handle     ( const char        * registration,
                                        const char        * command,
                                        oyOptions_s      ** result )
 {
-  int error = 0;
+  int error = 0, found = 0, from_disk = 0;
   oyOptions_s * s = options;
+  char * cache_key = NULL,
+       * module = NULL;
+  oyOptions_s * handled = NULL, ** results = result;
 
   if(!options && !command)
     return error;
 
   oyCheckType__m( oyOBJECT_OPTIONS_S, return 1 )
 
+  if(result)
+    cache_key = oyOptions_HandleCacheKey_( registration, options, command );
+  if(cache_key)
+  {
+    handled = oyOptions_HandleCacheGet_( cache_key );
+    if(handled)
+    {
+      oyOptions_HandleCacheResult_( handled, result );
+      oyOptions_Release( &handled );
+      oyFree_m_( cache_key );
+      return 0;
+    }
+    /* collect only this commands results */
+    results = &handled;
+  }
+
   if(!error)
   {
     oyCMMapiFilters_s * apis;
-    int apis_n = 0, i, found = 0;
+    int apis_n = 0, i;
     oyCMMapi10_s_ * cmm_api10 = 0;
     char * test = 0;
 
@@ -1985,7 +2571,7 @@ int             oyOptions_Handle     ( const char        * registration,
 
     apis_n = oyCMMapiFilters_Count( apis );
     if(test)
-      for(i = 0; i < apis_n; ++i)
+      for(i = 0; i < apis_n && !from_disk; ++i)
       {
         cmm_api10 = (oyCMMapi10_s_*) oyCMMapiFilters_Get( apis, i );
 
@@ -1993,11 +2579,20 @@ int             oyOptions_Handle     ( const char        * registration,
         {
           if(cmm_api10->oyMOptions_Handle)
           {
-            error = cmm_api10->oyMOptions_Handle( s, test, result );
+            error = cmm_api10->oyMOptions_Handle( s, test, results );
             if(error == 0)
             {
-              found = 1;
-              error = cmm_api10->oyMOptions_Handle( s, command, result );
+              ++found;
+              /* the disk tier is bound to the first handling module */
+              if(cache_key && found == 1 && !handled &&
+                 oyOptions_HandleCacheLimit_())
+              {
+                module = oyCMMapiCacheId_( (oyCMMapi_s*)cmm_api10 );
+                handled = oyOptions_HandleCacheFromDisk_( cache_key, module );
+                from_disk = handled != NULL;
+              }
+              if(!from_disk)
+                error = cmm_api10->oyMOptions_Handle( s, command, results );
             }
 
           } else
@@ -2022,6 +2617,20 @@ int             oyOptions_Handle     ( const char        * registration,
       error = -1;
   }
 
+  if(cache_key)
+  {
+    /* results of several modules stay in memory only */
+    if(error == 0 && handled)
+      oyOptions_HandleCachePut_( cache_key, handled,
+                                 found == 1 && !from_disk ? module : NULL );
+    if(handled)
+      oyOptions_HandleCacheResult_( handled, result );
+    oyOptions_Release( &handled );
+    oyFree_m_( cache_key );
+  }
+  if(module)
+    oyFree_m_( module );
+
   return error;
 }
 
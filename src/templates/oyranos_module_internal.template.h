@@ -230,6 +230,10 @@ oyCMMapi_s *     oyCMMsGetApi_       ( oyOBJECT_e          type,
 oyHash_s *   oyCMMCacheListGetEntry_ ( const char        * hash_text );
 oyStructList_s** oyCMMCacheList_     ( void );
 char   *     oyCMMCacheListPrint_    ( void );
+void         oyCacheDirTrim_         ( const char        * dir_name,
+                                       const char        * suffix,
+                                       size_t              limit );
+char *       oyCMMapiCacheId_        ( oyCMMapi_s        * api );
 oyCMMapis_s *  oyCMMGetMetaApis_     ( );
 int              oyCMMCanHandle_    ( oyCMMapi3_s        * api,
                                       oyCMMapiQueries_s  * queries );
@@ -56,6 +56,12 @@
   TEST_RUN( testCMMlists, "CMMs listing", 1 ); \
   TEST_RUN( testICCsCheck, "CMMs ICC conversion check", 1 ); \
   TEST_RUN( testCCorrectFlags, "Conversion Correct Option Flags", 1 ); \
+  TEST_RUN( testCMMLut3d, "CMM native 3D LUT", 1 ); \
+  TEST_RUN( testCMMMatrixShaper, "CMM matrix/shaper fast path", 1 ); \
+  TEST_RUN( testCMMIccMerge, "CMM ICC node merge", 1 ); \
+  TEST_RUN( testCMMXYZExtra, "CMM XYZ with extra channel", 1 ); \
+  TEST_RUN( testCMMBake, "CMM bake point wise nodes", 1 ); \
+  TEST_RUN( testCMMPrepareThreads, "CMM parallel context preparation", 1 ); \
   TEST_RUN( testCache, "Cache", 1 ); \
   TEST_RUN( testPaths, "Paths", 1 );
 
@@ -2520,6 +2526,8 @@ oyTESTRESULT_e testProfileLists ()
 
 #include "oyProfile_s_.h"           /* oyProfile_ToFile_ */
 #include "oyranos_color.h"
+#include "oyImage_s.h"
+#include "oyConversion_s.h"
 
 oyTESTRESULT_e testEffects ()
 {
@@ -2564,6 +2572,86 @@ oyTESTRESULT_e testEffects ()
   oyProfile_ToFile_( (oyProfile_s_*)abstract, "test_proof_effect.icc" );
   oyProfile_Release( &abstract );
 
+  /* The batched proofing grid has to match the point wise lcm2SamplerProof()
+   * reference, with and without gamut warning. */
+  {
+    uint32_t icc_profile_flags =oyICCProfileSelectionFlagsFromOptions( OY_CMM_STD,
+                                       "//" OY_TYPE_STD "/icc_color", NULL, 0 );
+    oyProfile_s * p_lab = oyProfile_FromStd( oyEDITING_LAB, icc_profile_flags, testobj );
+    const int n = 9, count = n*n*n;
+    uint16_t * lab_in = (uint16_t*) calloc( sizeof(uint16_t), 3*count ),
+             * lab_out[2] = { (uint16_t*) calloc( sizeof(uint16_t), 3*count ),
+                              (uint16_t*) calloc( sizeof(uint16_t), 3*count ) };
+    int gamut_warning, batch, i, max_diff = 0, gray = 0;
+
+    for(i = 0; i < count; ++i)
+    {
+      lab_in[i*3+0] = (uint16_t)(65535 * (i / (n*n)) / (n-1));
+      lab_in[i*3+1] = (uint16_t)(65535 * ((i / n) % n) / (n-1));
+      lab_in[i*3+2] = (uint16_t)(65535 * (i % n) / (n-1));
+    }
+
+    for(gamut_warning = 0; gamut_warning < 2; ++gamut_warning)
+    {
+      error = 0;
+      for(batch = 0; batch < 2; ++batch)
+      {
+        oyConversion_s * cc;
+        oyProfile_s * p = oyProfile_FromStd( oyEDITING_CMYK, 0, testobj );
+        oyOptions_MoveInStruct( &opts, "//" OY_TYPE_STD "/icc_profile.proofing_profile",
+                                (oyStruct_s**) &p, OY_CREATE_NEW );
+        oyOptions_SetFromString( &opts, "//" OY_TYPE_STD "/rendering_gamut_warning",
+                                 gamut_warning ? "1" : "0", OY_CREATE_NEW );
+        oyOptions_SetFromInt( &opts, "//" OY_TYPE_STD "/proofing_batch",
+                              batch, 0, OY_CREATE_NEW );
+        error = oyOptions_Handle( "//" OY_TYPE_STD "/create_profile.proofing_effect",
+                                  opts,"create_profile.proofing_effect",
+                                  &result_opts );
+        abstract = (oyProfile_s*)oyOptions_GetType( result_opts, -1, "icc_profile",
+                                                    oyOBJECT_PROFILE_S );
+        oyOptions_Release( &result_opts );
+        oyOptions_Release( &opts );
+
+        oyOptions_SetFromString( &opts, "////context", "lcm2", OY_CREATE_NEW );
+        cc = oyConversion_CreateBasicPixelsFromBuffers(
+                              abstract, lab_in, oyChannels_m(3) | oyDataType_m(oyUINT16),
+                              p_lab, lab_out[batch], oyChannels_m(3) | oyDataType_m(oyUINT16),
+                                                    opts, count );
+        oyOptions_Release( &opts );
+        error = cc ? oyConversion_RunPixels( cc, NULL ) : 1;
+        oyConversion_Release( &cc );
+        oyProfile_Release( &abstract );
+        if(error) break;
+      }
+
+      max_diff = gray = 0;
+      for(i = 0; i < 3*count; ++i)
+      {
+        int d = abs( (int)lab_out[0][i] - (int)lab_out[1][i] );
+        if(d > max_diff) max_diff = d;
+      }
+      for(i = 0; i < count; ++i)
+        /* out of gamut marked as L=50 a=b=0, v2 or v4 Lab encoding */
+        if(abs( lab_out[1][i*3+0] - 32768 ) < 300 &&
+           abs( lab_out[1][i*3+1] - 32768 ) < 300 &&
+           abs( lab_out[1][i*3+2] - 32768 ) < 300)
+          ++gray;
+
+      if(!error && max_diff == 0 && (!gamut_warning || gray))
+      { PRINT_SUB( oyTESTRESULT_SUCCESS,
+        "proofing grid batch == point wise gamut_warning: %d (gray: %d)",
+        gamut_warning, gray );
+      } else
+      { PRINT_SUB( oyTESTRESULT_FAIL,
+        "proofing grid batch == point wise gamut_warning: %d error: %d diff: %d gray: %d",
+        gamut_warning, error, max_diff, gray );
+      }
+    }
+
+    free( lab_in ); free( lab_out[0] ); free( lab_out[1] );
+    oyProfile_Release( &p_lab );
+  }
+
 
   double XYZ[3] = {-1, -1, -1};
   double Lab[3], cie_a, cie_b, dst_cie_a, dst_cie_b;
@@ -2607,6 +2695,50 @@ oyTESTRESULT_e testEffects ()
   oyProfile_ToFile_( (oyProfile_s_*)abstract, "test_wtpt_effect-lab.icc" );
   oyProfile_Release( &abstract );
 
+  /* The sampler leaves the PCS range at the grid corners. The 16-bit CLUT
+   * has to clip there and must not wrap around. */
+  error = oyOptions_SetFromDouble( &opts, "//" OY_TYPE_STD "/cie_a",
+                                   0.5, 0, OY_CREATE_NEW );
+  error = oyOptions_SetFromDouble( &opts, "//" OY_TYPE_STD "/cie_b",
+                                   -0.5, 0, OY_CREATE_NEW );
+  error = oyOptions_SetFromInt( &opts, "//" OY_TYPE_STD "/grid_points",
+                                5, 0, OY_CREATE_NEW );
+  error = oyOptions_Handle( "//" OY_TYPE_STD "/create_profile.white_point_adjust.lab",
+                            opts,"create_profile.white_point_adjust.lab",
+                            &result_opts );
+  abstract = (oyProfile_s*)oyOptions_GetType( result_opts, -1, "icc_profile",
+                                              oyOBJECT_PROFILE_S );
+  oyOptions_Release( &result_opts );
+  oyOptions_Release( &opts );
+  if(!abstract)
+  { PRINT_SUB( oyTESTRESULT_XFAIL,
+    "oyOptions_Handle(\"create_profile\") clipping no" );
+  } else
+  {
+    uint32_t icc_profile_flags =oyICCProfileSelectionFlagsFromOptions( OY_CMM_STD,
+                                       "//" OY_TYPE_STD "/icc_color", NULL, 0 );
+    oyProfile_s * p_lab = oyProfile_FromStd( oyEDITING_LAB, icc_profile_flags, testobj );
+    /* white with maximal CIE*a and minimal CIE*b: a + 0.5 > 1, b - 0.5 < 0 */
+    uint16_t lab_in[3] = {65535, 65535, 0}, lab_out[3] = {0, 32896, 32896};
+    oyOptions_SetFromString( &opts, "////context", "lcm2", OY_CREATE_NEW );
+    oyConversion_s * cc = oyConversion_CreateBasicPixelsFromBuffers(
+                              abstract, lab_in, oyChannels_m(3) | oyDataType_m(oyUINT16),
+                              p_lab, lab_out, oyChannels_m(3) | oyDataType_m(oyUINT16),
+                                                    opts, 1 );
+    oyOptions_Release( &opts );
+    error = cc ? oyConversion_RunPixels( cc, NULL ) : 1;
+    if(!error && lab_out[1] > 60000 && lab_out[2] < 5000)
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "16-bit CLUT clips outside 0..1   %d %d %d", lab_out[0], lab_out[1], lab_out[2] );
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "16-bit CLUT clips outside 0..1   %d %d %d error: %d", lab_out[0], lab_out[1], lab_out[2], error );
+    }
+    oyConversion_Release( &cc );
+    oyProfile_Release( &p_lab );
+  }
+  oyProfile_Release( &abstract );
+
 
   double        src_XYZ[3] = {0.0, 0.0, 0.0}, dst_XYZ[3] = {0.0, 0.0, 0.0};
   error = oyGetDisplayWhitePoint( 2, src_XYZ );
@@ -2645,6 +2777,33 @@ oyTESTRESULT_e testEffects ()
   abstract = (oyProfile_s*)oyOptions_GetType( result_opts, -1, "icc_profile",
                                               oyOBJECT_PROFILE_S );
   oyOptions_Release( &result_opts );
+
+  if(abstract)
+  {
+    oyProfile_s * cached;
+    double clck = oyClock();
+    error = oyOptions_Handle( "//" OY_TYPE_STD "/create_profile.white_point_adjust.bradford",
+                            opts,"create_profile.white_point_adjust.bradford",
+                            &result_opts );
+    clck = oyClock() - clck;
+    cached = (oyProfile_s*)oyOptions_GetType( result_opts, -1, "icc_profile",
+                                              oyOBJECT_PROFILE_S );
+    oyOptions_Release( &result_opts );
+    uint32_t md5[4] = {0,0,0,0}, md5_cached[4] = {1,1,1,1};
+    oyProfile_GetMD5( abstract, OY_COMPUTE, md5 );
+    oyProfile_GetMD5( cached, OY_COMPUTE, md5_cached );
+    /* the same profile, but not the cached object */
+    if(!error && cached && cached != abstract &&
+       memcmp( md5, md5_cached, sizeof(md5) ) == 0)
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "oyOptions_Handle(\"create_profile\") cached    %s",
+      oyProfilingToString(1,clck/(double)CLOCKS_PER_SEC, "Handle") );
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "oyOptions_Handle(\"create_profile\") cached    %d", error );
+    }
+    oyProfile_Release( &cached );
+  }
   oyOptions_Release( &opts );
 
   text = oyProfile_GetText( abstract, oyNAME_DESCRIPTION );
@@ -2669,9 +2828,6 @@ oyTESTRESULT_e testEffects ()
   return result;
 }
 
-#include "oyImage_s.h"
-#include "oyConversion_s.h"
-
 oyTESTRESULT_e testDeviceLinkProfile ()
 {
   oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
@@ -5855,6 +6011,41 @@ oyTESTRESULT_e testCMMnmRun ()
   }
 
 
+  /* a prepared color list with two full rows and a short tail */
+  {
+    double list_in[3*70], list_out[3*70];
+    int count = 70, equal = 1;
+    oyConversion_s * cc = oyConversion_CreateColors( p_in, oyDataType_m(oyDOUBLE),
+                                                     p_out, oyDataType_m(oyDOUBLE),
+                                                     options, testobj );
+    for(i = 0; i < 3*count; ++i)
+    {
+      list_in[i] = 1.0;
+      list_out[i] = -1.0;
+    }
+    error = oyConversion_RunColors( cc, list_in, list_out, count );
+    for(i = 3; i < 3*count; ++i)
+      if(list_out[i] != list_out[i%3])
+        equal = 0;
+
+    clck = oyClock();
+    for(i = 0; i < n*1000 && !error; ++i)
+      error = oyConversion_RunColors( cc, list_in, list_out, 1 );
+    clck = oyClock() - clck;
+    oyConversion_Release( &cc );
+
+    if( !error && equal && list_out[0] > 0.0 )
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "oyConversion_RunColors()          %s",
+                          oyProfilingToString(i,clck/(double)CLOCKS_PER_SEC, "Pixel"));
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "oyConversion_RunColors() %d %.02g %.02g %.02g", equal,
+                          list_out[0], list_out[1], list_out[2] );
+    }
+  }
+
+
   conv = oyConversion_New( testobj );
   oyFilterNode_s * in_node = oyFilterNode_NewWith( "//" OY_TYPE_STD "/root", 0, testobj );
   oyConversion_Set( conv, in_node, 0 );
@@ -5946,6 +6137,65 @@ oyTESTRESULT_e testCMMnmRun ()
     { PRINT_SUB( oyTESTRESULT_FAIL,
       "oyNamedColor_CreateWithName()            " );
     }
+
+    oyProfile_s * p_lab = oyProfile_FromStd( oyEDITING_LAB, icc_profile_flags, testobj );
+    int count = oyNamedColors_Count( colors );
+    double * lab_all = (double*) calloc( sizeof(double), count * 3 ),
+             lab[3] = {-1,-1,-1};
+
+    clck = oyClock();
+    error = oyNamedColors_Convert( colors, p_lab, lab_all, oyDOUBLE, icc_profile_flags, NULL );
+    clck = oyClock() - clck;
+
+    /* each batch entry matches the per color path */
+    double max_diff = 0.0;
+    int worst = 0;
+    for(i = 0; i < count && !error; ++i)
+    {
+      int j;
+      ncl = oyNamedColors_Get( colors, i );
+      error = oyNamedColor_GetColor( ncl, p_lab, lab, oyDOUBLE, icc_profile_flags, NULL );
+      oyNamedColor_Release( &ncl );
+      for(j = 0; j < 3; ++j)
+        if(fabs(lab[j] - lab_all[i*3+j]) > max_diff)
+        {
+          max_diff = fabs(lab[j] - lab_all[i*3+j]);
+          worst = i;
+        }
+    }
+
+    if( !error && count == 1000 && max_diff < 0.001 )
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "oyNamedColors_Convert()           %s",
+                          oyProfilingToString(count,clck/(double)CLOCKS_PER_SEC, "Ncl"));
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "oyNamedColors_Convert() %d [%d] max diff: %g error: %d", count,
+      worst, max_diff, error );
+    }
+
+    /* channels only colors get their XYZ filled */
+    oyNamedColors_Clear( colors );
+    for( i = 0; i < 10; ++i )
+    {
+      double device[4] = {0.1*i,0.2,0.1,0.5};
+      ncl = oyNamedColor_Create( device, NULL, 0, p_cmyk, testobj );
+      oyNamedColors_MoveIn( colors, &ncl, i );
+    }
+    error = oyNamedColors_Convert( colors, NULL, NULL, oyDOUBLE, icc_profile_flags, NULL );
+    ncl = oyNamedColors_Get( colors, 9 );
+    const double * XYZ = oyNamedColor_GetXYZConst( ncl );
+    if( !error && XYZ[0] != -1 && XYZ[1] != -1 && XYZ[2] != -1 )
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "oyNamedColors_Convert( XYZ )      %g %g %g", XYZ[0], XYZ[1], XYZ[2] );
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "oyNamedColors_Convert( XYZ )      %g %g %g", XYZ[0], XYZ[1], XYZ[2] );
+    }
+    oyNamedColor_Release( &ncl );
+
+    free( lab_all );
+    oyProfile_Release( &p_lab );
   }
 
   
@@ -5954,6 +6204,66 @@ oyTESTRESULT_e testCMMnmRun ()
 
 #include "oyRectangle_s_.h"
 
+/* line accessors for streamed images; pixel_data holds a oyBlob_s */
+static oyPointer testStreamGetLine   ( oyImage_s         * image,
+                                       int                 line_y,
+                                       int               * height,
+                                       int                 channel OY_UNUSED,
+                                       int               * is_allocated )
+{
+  oyBlob_s * blob = (oyBlob_s*) oyImage_GetPixelData( image );
+  size_t len = oyImage_GetWidth( image ) * 3 * sizeof(uint16_t);
+  uint16_t * buf = (uint16_t*) oyBlob_GetPointer( blob ),
+           * line = (uint16_t*) oyAllocateFunc_( len );
+  memcpy( line, &buf[line_y * oyImage_GetWidth( image ) * 3], len );
+  oyBlob_Release( &blob );
+  *height = 1;
+  *is_allocated = 1;
+  return line;
+}
+static int testStreamSetLine         ( oyImage_s         * image,
+                                       int                 point_x,
+                                       int                 point_y,
+                                       int                 pixel_n,
+                                       int                 channel OY_UNUSED,
+                                       oyPointer           data )
+{
+  oyBlob_s * blob = (oyBlob_s*) oyImage_GetPixelData( image );
+  char * buf = (char*) oyBlob_GetPointer( blob );
+  int w = oyImage_GetWidth( image );
+  if(pixel_n < 0)
+    pixel_n = w - point_x;
+  /* point_x is in pixel * byte size, as from oyImage_ReadArray() */
+  memcpy( &buf[(point_y * w * 3) * sizeof(uint16_t) + point_x * 3],
+          data, pixel_n * 3 * sizeof(uint16_t) );
+  oyBlob_Release( &blob );
+  return 0;
+}
+
+static int test_async_status = 0, test_async_progress = 0;
+static void testAsyncProgress        ( double              progress_zero_till_one,
+                                       char              * status_text OY_UNUSED,
+                                       int                 thread_id_ OY_UNUSED,
+                                       int                 job_id OY_UNUSED,
+                                       oyStruct_s        * cb_progress_context OY_UNUSED )
+{
+  if(progress_zero_till_one > 0.0)
+    ++test_async_progress;
+}
+static int testAsyncFinish           ( oyJob_s           * job )
+{
+  /* 1 - done, 2 - canceled, 3 - error */
+  test_async_status = job->status_work_return == 0 ? 1 :
+                      job->status_work_return < 0 ? 2 : 3;
+  return 0;
+}
+static void testAsyncWait            ( int                 id )
+{
+  double t0 = oyClock();
+  while(id && !test_async_status && oyClock() - t0 < 30.0 * CLOCKS_PER_SEC)
+    oyJobResult();
+}
+
 oyTESTRESULT_e testImagePixel()
 {
   oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
@@ -6166,11 +6476,446 @@ oyTESTRESULT_e testImagePixel()
                   buf_16out2x2[9], buf_16out2x2[10], buf_16out2x2[11] );
 
 
+  {
+    /* compare tiled processing against one run over the whole image */
+    int w = 67, h = 41, k, diff = 0;
+    uint16_t * buf_in = (uint16_t*) calloc( sizeof(uint16_t), w*h*3 ),
+             * buf_a = (uint16_t*) calloc( sizeof(uint16_t), w*h*3 ),
+             * buf_b = (uint16_t*) calloc( sizeof(uint16_t), w*h*3 );
+    oyImage_s * in, * out_a, * out_b;
+    oyConversion_s * cc_a, * cc_b;
+
+    for(k = 0; k < w*h*3; ++k)
+      buf_in[k] = (k * 257) % 65536;
+    in    = oyImage_Create( w,h, buf_in, OY_TYPE_123_16, p_web, testobj );
+    out_a = oyImage_Create( w,h, buf_a, OY_TYPE_123_16, p_lab, testobj );
+    out_b = oyImage_Create( w,h, buf_b, OY_TYPE_123_16, p_lab, testobj );
+    cc_a = oyConversion_CreateBasicPixels( in, out_a, 0, testobj );
+    cc_b = oyConversion_CreateBasicPixels( in, out_b, 0, testobj );
+
+    error = oyConversion_RunPixels( cc_a, NULL );
+    clck = oyClock();
+    if(!error)
+      error = oyConversion_RunPixelsTiled( cc_b, NULL, 16, 8, 0 );
+    clck = oyClock() - clck;
+    for(k = 0; k < w*h*3; ++k)
+      if(buf_a[k] != buf_b[k])
+        ++diff;
+
+    if( !error && !diff )
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "oyConversion_RunPixelsTiled() 16x8 tiles %s",
+                          oyProfilingToString(w*h,clck/(double)CLOCKS_PER_SEC, "Pixel"));
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "oyConversion_RunPixelsTiled() 16x8 tiles error: %d diff: %d", error, diff );
+    }
+
+    /* the same tiles in a background job */
+    memset( buf_b, 0, sizeof(uint16_t) * w*h*3 );
+    oyJob_s * job = oyJob_New( testobj );
+    job->cb_progress = testAsyncProgress;
+    job->finish = testAsyncFinish;
+    test_async_status = test_async_progress = 0;
+    clck = oyClock();
+    int id = oyConversion_RunPixelsAsync( cc_b, NULL, 16, 8, &job );
+    testAsyncWait( id );
+    clck = oyClock() - clck;
+    diff = 0;
+    for(k = 0; k < w*h*3; ++k)
+      if(buf_a[k] != buf_b[k])
+        ++diff;
+
+    if( id && test_async_status == 1 && !diff && test_async_progress > 1 )
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "oyConversion_RunPixelsAsync() %d messages %s", test_async_progress,
+                          oyProfilingToString(w*h,clck/(double)CLOCKS_PER_SEC, "Pixel"));
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "oyConversion_RunPixelsAsync() id: %d status: %d diff: %d", id, test_async_status, diff );
+    }
+
+    /* a canceled job finishes without error, possibly before any tile */
+    job = oyJob_New( testobj );
+    job->cb_progress = testAsyncProgress;
+    job->finish = testAsyncFinish;
+    test_async_status = 0;
+    id = oyConversion_RunPixelsAsync( cc_b, NULL, 16, 8, &job );
+    oyConversion_Cancel( cc_b );
+    testAsyncWait( id );
+
+    if( id && (test_async_status == 1 || test_async_status == 2) )
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "oyConversion_Cancel() %s", test_async_status == 2 ? "canceled" : "was too late" );
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "oyConversion_Cancel() id: %d status: %d", id, test_async_status );
+    }
+
+    /* recompute only a changed rectangle of the input */
+    int outside = 0, dirty_n;
+    memset( buf_b, 0, sizeof(uint16_t) * w*h*3 );
+    oyRectangle_s * changed = oyRectangle_NewWith( 10, 5, 20, 7, testobj );
+    oyFilterNode_s * node_in = oyConversion_GetNode( cc_b, OY_INPUT );
+    oyFilterNode_SetDirty( node_in, changed );
+    dirty_n = oyImage_CountDirty( out_b );
+    clck = oyClock();
+    error = oyConversion_RunPixelsDirty( cc_b, NULL, 0 );
+    clck = oyClock() - clck;
+    diff = 0;
+    for(k = 0; k < w*h*3; ++k)
+    {
+      int x = (k / 3) % w, y = (k / 3) / w;
+      if(x >= 10 && x < 30 && y >= 5 && y < 12)
+      { if(buf_a[k] != buf_b[k]) ++diff; }
+      else if(buf_b[k])
+        ++outside;
+    }
+
+    if( !error && dirty_n == 1 && !diff && !outside &&
+        oyImage_CountDirty( out_b ) == 0 )
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "oyConversion_RunPixelsDirty() 20x7 %s",
+                          oyProfilingToString(20*7,clck/(double)CLOCKS_PER_SEC, "Pixel"));
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "oyConversion_RunPixelsDirty() error: %d dirty: %d diff: %d outside: %d",
+      error, dirty_n, diff, outside );
+    }
+    oyFilterNode_Release( &node_in );
+    oyRectangle_Release( &changed );
+
+    /* a revisited region is copied from the tile cache; the unmarked
+     * change of the input shows, that no transform did run */
+    oyConversion_SetTileCache( cc_b, 1 << 22 );
+    error = oyConversion_RunPixels( cc_b, NULL );
+    memset( buf_b, 0, sizeof(uint16_t) * w*h*3 );
+    buf_in[0] = ~buf_in[0];
+    clck = oyClock();
+    if(!error)
+      error = oyConversion_RunPixels( cc_b, NULL );
+    clck = oyClock() - clck;
+    buf_in[0] = ~buf_in[0];
+    diff = 0;
+    for(k = 0; k < w*h*3; ++k)
+      if(buf_a[k] != buf_b[k])
+        ++diff;
+    oyConversion_SetTileCache( cc_b, 0 );
+
+    if( !error && !diff )
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "oyConversion_SetTileCache() hit %s",
+                          oyProfilingToString(w*h,clck/(double)CLOCKS_PER_SEC, "Pixel"));
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "oyConversion_SetTileCache() error: %d diff: %d", error, diff );
+    }
+
+    /* per node counters as JSON */
+    oyConversion_SetStats( cc_b, 1 );
+    error = oyConversion_RunPixels( cc_b, NULL );
+    char * stats = oyConversion_GetStats( cc_b, oyAllocateFunc_ );
+    char stats_error[128] = {0};
+    oyjl_val stats_root = stats ? oyjlTreeParse( stats, stats_error, 128 ) : NULL;
+    int stats_n = oyjlValueCount( oyjlTreeGetValue( stats_root, 0, "nodes" ) );
+    oyConversion_SetStats( cc_b, 0 );
+
+    if( !error && stats_n == 3 && strstr( stats, "\"calls\": 1," ) )
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "oyConversion_GetStats() %d nodes                   ", stats_n );
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "oyConversion_GetStats() error: %d nodes: %d %s", error, stats_n, stats_error );
+    }
+    if(oy_debug)
+      fprintf( zout, "%s", oyNoEmptyString_m_(stats) );
+    oyjlTreeFree( stats_root );
+    if(stats) oyFree_m_( stats );
+
+    /* trace-event file */
+    int r OY_UNUSED = remove( "test2_trace.json" );
+    oyTraceStart( "test2_trace.json" );
+    error = oyConversion_RunPixels( cc_b, NULL );
+    oyTraceStop();
+    size_t trace_size = 0;
+    char * trace = oyReadFileToMem_( "test2_trace.json", &trace_size, oyAllocateFunc_ );
+    oyjl_val trace_root = trace ? oyjlTreeParse( trace, stats_error, 128 ) : NULL;
+    int trace_n = oyjlValueCount( trace_root );
+
+    if( !error && trace_n > 3 && strstr( trace, "\"oyImage_FillArray\"" ) )
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "oyTraceStart() %d events                         ", trace_n );
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "oyTraceStart() error: %d events: %d %s", error, trace_n, stats_error );
+    }
+    oyjlTreeFree( trace_root );
+    if(trace) oyFree_m_( trace );
+    r = remove( "test2_trace.json" );
+
+    /* stream bands of lines through images without pixel buffers */
+    oyBlob_s * blob_in = oyBlob_New( testobj ),
+             * blob_out = oyBlob_New( testobj );
+    oyImage_s * in_s, * out_s;
+    oyConversion_s * cc_s;
+    memset( buf_b, 0, sizeof(uint16_t) * w*h*3 );
+    oyBlob_SetFromStatic( blob_in, buf_in, 0, "uint16_t" );
+    oyBlob_SetFromStatic( blob_out, buf_b, 0, "uint16_t" );
+    in_s  = oyImage_CreateFromLines( w,h, OY_TYPE_123_16, p_web,
+                                     (oyStruct_s**)&blob_in,
+                                     testStreamGetLine, NULL, testobj );
+    out_s = oyImage_CreateFromLines( w,h, OY_TYPE_123_16, p_lab,
+                                     (oyStruct_s**)&blob_out,
+                                     NULL, testStreamSetLine, testobj );
+    cc_s = oyConversion_CreateBasicPixels( in_s, out_s, 0, testobj );
+    error = oyConversion_RunPixelsTiled( cc_s, NULL, 0, 16, 1 );
+    diff = 0;
+    for(k = 0; k < w*h*3; ++k)
+      if(buf_a[k] != buf_b[k])
+        ++diff;
+
+    if( !error && !diff && in_s && out_s )
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "oyImage_CreateFromLines() bands of 16 lines        " );
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "oyImage_CreateFromLines() bands error: %d diff: %d", error, diff );
+    }
+
+    {
+      /* wrap padded and bottom-up rows without copy */
+      int pad = w*3 + 5, y, x;
+      uint16_t * up = (uint16_t*) calloc( sizeof(uint16_t), pad*h ),
+               * down = (uint16_t*) calloc( sizeof(uint16_t), pad*h );
+      oyConversion_s * cc_p;
+      for(y = 0; y < h; ++y)
+        memcpy( &up[(h-1-y)*pad], &buf_in[y*w*3], sizeof(uint16_t)*w*3 );
+      cc_p = oyConversion_CreateBasicPixelsFromStrides( p_web,
+                                  &up[(h-1)*pad], -pad*(int)sizeof(uint16_t),
+                                  OY_TYPE_123_16, p_lab,
+                                  down, pad*(int)sizeof(uint16_t),
+                                  OY_TYPE_123_16, 0, w, h );
+      error = oyConversion_RunPixels( cc_p, NULL );
+      diff = 0;
+      for(y = 0; y < h; ++y)
+        for(x = 0; x < w*3; ++x)
+          if(buf_a[y*w*3 + x] != down[y*pad + x])
+            ++diff;
+
+      if( !error && !diff && cc_p )
+      { PRINT_SUB( oyTESTRESULT_SUCCESS,
+        "oyConversion_CreateBasicPixelsFromStrides() bottom-up" );
+      } else
+      { PRINT_SUB( oyTESTRESULT_FAIL,
+        "oyConversion_CreateBasicPixelsFromStrides() error: %d diff: %d", error, diff );
+      }
+      oyConversion_Release( &cc_p );
+      free( up ); free( down );
+    }
+
+    {
+      /* convert one buffer in place */
+      uint16_t * one = (uint16_t*) malloc( sizeof(uint16_t) * w*h*3 ),
+               * unused = (uint16_t*) calloc( sizeof(uint16_t), w*h*3 );
+      oyOptions_s * opts = NULL;
+      oyImage_s * in_p, * out_p;
+      oyConversion_s * cc_p;
+      oyStruct_s * data_in, * data_out;
+      int untouched = 1;
+      memcpy( one, buf_in, sizeof(uint16_t) * w*h*3 );
+      oyOptions_SetFromString( &opts, "//" OY_TYPE_STD "/in_place", "1",
+                               OY_CREATE_NEW );
+      in_p  = oyImage_Create( w,h, one, OY_TYPE_123_16, p_web, testobj );
+      out_p = oyImage_Create( w,h, unused, OY_TYPE_123_16, p_lab, testobj );
+      cc_p = oyConversion_CreateBasicPixels( in_p, out_p, opts, testobj );
+      error = oyConversion_RunPixels( cc_p, NULL );
+      data_in = oyImage_GetPixelData( in_p );
+      data_out = oyImage_GetPixelData( out_p );
+      diff = 0;
+      for(k = 0; k < w*h*3; ++k)
+      {
+        if(buf_a[k] != one[k])
+          ++diff;
+        if(unused[k])
+          untouched = 0;
+      }
+
+      if( !error && !diff && untouched && data_in == data_out )
+      { PRINT_SUB( oyTESTRESULT_SUCCESS,
+        "oyConversion_CreateBasicPixels( \"in_place\" )          " );
+      } else
+      { PRINT_SUB( oyTESTRESULT_FAIL,
+        "oyConversion_CreateBasicPixels( \"in_place\" ) error: %d diff: %d", error, diff );
+      }
+      data_in->release( &data_in );
+      data_out->release( &data_out );
+      oyConversion_Release( &cc_p );
+      oyImage_Release( &in_p );
+      oyImage_Release( &out_p );
+      oyOptions_Release( &opts );
+      free( one ); free( unused );
+    }
+
+    {
+      /* apply one prepared conversion to several image pairs */
+      enum { N = 5 };
+      uint16_t * outs[N];
+      oyImage_s * ins_b[N], * outs_b[N];
+      int hs[N] = { h, h/2, 1, h, 7 }, n;
+      for(n = 0; n < N; ++n)
+      {
+        outs[n] = (uint16_t*) calloc( sizeof(uint16_t), w*h*3 );
+        ins_b[n] = oyImage_Create( w,hs[n], buf_in, OY_TYPE_123_16, p_web, testobj );
+        outs_b[n] = oyImage_Create( w,hs[n], outs[n], OY_TYPE_123_16, p_lab, testobj );
+      }
+      clck = oyClock();
+      error = oyConversion_RunPixelsBatch( cc_a, N, ins_b, outs_b, 2 );
+      clck = oyClock() - clck;
+      diff = 0;
+      for(n = 0; n < N; ++n)
+        for(k = 0; k < w*hs[n]*3; ++k)
+          if(buf_a[k] != outs[n][k])
+            ++diff;
+
+      if( !error && !diff )
+      { PRINT_SUB( oyTESTRESULT_SUCCESS,
+        "oyConversion_RunPixelsBatch() %d images %s", N,
+                          oyProfilingToString(N,clck/(double)CLOCKS_PER_SEC, "Image"));
+      } else
+      { PRINT_SUB( oyTESTRESULT_FAIL,
+        "oyConversion_RunPixelsBatch() error: %d diff: %d", error, diff );
+      }
+      for(n = 0; n < N; ++n)
+      {
+        oyImage_Release( &ins_b[n] );
+        oyImage_Release( &outs_b[n] );
+        free( outs[n] );
+      }
+    }
+
+    {
+      /* a three node graph without ICC node is not cloned as ICC graph */
+      enum { N = 4 };
+      uint16_t * outs[2][N];
+      oyImage_s * ins_b[N], * outs_b[2][N];
+      oyOptions_s * opts = NULL;
+      oyConversion_s * cc_e = oyConversion_New( testobj );
+      oyFilterNode_s * root = oyFilterNode_NewWith( "//" OY_TYPE_STD "/root", NULL, testobj ),
+                     * expose,
+                     * output = oyFilterNode_NewWith( "//" OY_TYPE_STD "/output", NULL, testobj );
+      int n, t;
+
+      oyOptions_SetFromDouble( &opts, "//" OY_TYPE_STD "/expose/expose", 0.8, 0, OY_CREATE_NEW );
+      expose = oyFilterNode_NewWith( "//" OY_TYPE_STD "/expose", opts, testobj );
+      oyOptions_Release( &opts );
+      for(n = 0; n < N; ++n)
+      {
+        ins_b[n] = oyImage_Create( w,h, buf_in, OY_TYPE_123_16, p_web, testobj );
+        for(t = 0; t < 2; ++t)
+        {
+          outs[t][n] = (uint16_t*) calloc( sizeof(uint16_t), w*h*3 );
+          outs_b[t][n] = oyImage_Create( w,h, outs[t][n], OY_TYPE_123_16, p_web, testobj );
+        }
+      }
+      error = !root || !expose || !output;
+      if(!error) error = oyConversion_Set( cc_e, root, 0 );
+      if(!error) error = oyFilterNode_SetData( root, (oyStruct_s*)ins_b[0], 0, 0 );
+      if(!error) error = oyFilterNode_SetData( expose, (oyStruct_s*)outs_b[0][0], 0, 0 );
+      if(!error) error = oyFilterNode_Connect( root, "//" OY_TYPE_STD "/data",
+                                               expose, "//" OY_TYPE_STD "/data", 0 );
+      if(!error) error = oyFilterNode_Connect( expose, "//" OY_TYPE_STD "/data",
+                                               output, "//" OY_TYPE_STD "/data", 0 );
+      if(!error) error = oyConversion_Set( cc_e, 0, output );
+
+      /* serial reference and two threads */
+      if(!error) error = oyConversion_RunPixelsBatch( cc_e, N, ins_b, outs_b[0], 1 );
+      if(!error) error = oyConversion_RunPixelsBatch( cc_e, N, ins_b, outs_b[1], 2 );
+      diff = 0;
+      for(n = 0; n < N; ++n)
+        for(k = 0; k < w*h*3; ++k)
+          if(outs[0][n][k] != outs[1][n][k])
+            ++diff;
+
+      if( !error && !diff && outs[0][N-1][w*h*3-1] != buf_in[w*h*3-1] )
+      { PRINT_SUB( oyTESTRESULT_SUCCESS,
+        "oyConversion_RunPixelsBatch() expose graph      " );
+      } else
+      { PRINT_SUB( oyTESTRESULT_FAIL,
+        "oyConversion_RunPixelsBatch() expose graph error: %d diff: %d", error, diff );
+      }
+      oyConversion_Release( &cc_e );
+      for(n = 0; n < N; ++n)
+      {
+        oyImage_Release( &ins_b[n] );
+        for(t = 0; t < 2; ++t)
+        {
+          oyImage_Release( &outs_b[t][n] );
+          free( outs[t][n] );
+        }
+      }
+    }
+
+    oyConversion_Release( &cc_s );
+    oyImage_Release( &in_s );
+    oyImage_Release( &out_s );
+    oyConversion_Release( &cc_a );
+    oyConversion_Release( &cc_b );
+    oyImage_Release( &in );
+    oyImage_Release( &out_a );
+    oyImage_Release( &out_b );
+    free( buf_in ); free( buf_a ); free( buf_b );
+  }
+
   oyConversion_Release ( &cc );
   oyPixelAccess_Release( &pixel_access );
   oyProfile_Release( &p_lab );
   oyProfile_Release( &p_web );
 
+  {
+    /* rows of a aligned array live in one padded block */
+    oyArray2d_s * al = oyArray2d_CreateAligned( 7*3, 5, oyUINT16, testobj );
+    unsigned char ** rows = al ? (unsigned char**) oyArray2d_GetData( al ) : NULL;
+    int stride = oyArray2d_GetStride( al ), misaligned = 0, y;
+    for(y = 0; rows && y < 5; ++y)
+      if((uintptr_t)rows[y] % 64 || (y && rows[y] - rows[y-1] != stride))
+        ++misaligned;
+
+    if( rows && stride >= 7*3*2 && stride % 64 == 0 && !misaligned )
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "oyArray2d_CreateAligned() stride: %d                 ", stride );
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "oyArray2d_CreateAligned() stride: %d misaligned: %d", stride, misaligned );
+    }
+    oyArray2d_Release( &al );
+
+    /* a released block is reused by the next array of similar size;
+     * only arrays with the default allocators are pooled, not testobj */
+    {
+      oyPointer first, second, third;
+      size_t budget;
+      al = oyArray2d_CreateAligned( 640*4, 480, oyUINT8, NULL );
+      first = al ? ((unsigned char**) oyArray2d_GetData( al ))[0] : NULL;
+      oyArray2d_Release( &al );
+      al = oyArray2d_CreateAligned( 639*4, 480, oyUINT8, NULL );
+      second = al ? ((unsigned char**) oyArray2d_GetData( al ))[0] : NULL;
+      oyArray2d_Release( &al );
+      budget = oyArray2d_SetPoolBudget( 0 );
+      al = oyArray2d_CreateAligned( 20*4, 2, oyUINT8, NULL );
+      third = al ? ((unsigned char**) oyArray2d_GetData( al ))[0] : NULL;
+      oyArray2d_Release( &al );
+      oyArray2d_SetPoolBudget( budget );
+
+      if( first && first == second && third && budget )
+      { PRINT_SUB( oyTESTRESULT_SUCCESS,
+        "oyArray2d_SetPoolBudget() %lu reuse                ", (unsigned long)budget );
+      } else
+      { PRINT_SUB( oyTESTRESULT_FAIL,
+        "oyArray2d_SetPoolBudget() %lu reuse %p %p", (unsigned long)budget, first, second );
+      }
+    }
+  }
+
   oyPixel_t pixel_layout = OY_TYPE_123_16;
   oyPointer channels = 0;
   oyRectangle_s_ roi_ = {oyOBJECT_RECTANGLE_S, 0,0,0,0,0,0,0};
@@ -7768,31 +8513,1108 @@ oyTESTRESULT_e testCCorrectFlags( )
   return result;
 }
 
-#include "oyranos_generic_internal.h"
-oyHash_s *   oyTestCacheListGetEntry_ ( const char        * hash_text)
+/* the lcm2 kernel name of a fast path, as tagged on the ICC node at run time */
+static const char * testIccNodeKernel_( oyConversion_s * cc, const char * path )
 {
-  if(!oy_test_cache_)
-    oy_test_cache_ = oyStructList_Create( oyOBJECT_NONE, "oy_test_cache_", testobj );
+  oyFilterNode_s * node = oyConversion_GetNode( cc, OY_INPUT ), * icc;
+  oyFilterGraph_s * g = oyFilterGraph_FromNode( node, 0 );
+  oyOptions_s * tags;
+  const char * kernel;
 
-  return oyCacheListGetEntry_(oy_test_cache_, 0, hash_text);
+  icc = oyFilterGraph_GetNode( g, -1, "//" OY_TYPE_STD "/icc_color", NULL );
+  tags = oyFilterNode_GetTags( icc );
+  /* the node tags keep the string alive as long as the conversion */
+  kernel = oyOptions_FindString( tags, path, NULL );
+
+  oyOptions_Release( &tags );
+  oyFilterNode_Release( &icc );
+  oyFilterGraph_Release( &g );
+  oyFilterNode_Release( &node );
+
+  return kernel;
 }
 
-oyTESTRESULT_e testCache()
+oyTESTRESULT_e testCMMLut3d( )
 {
   oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
 
   fprintf(stdout, "\n" );
 
-  int verbose = 0;
-  char * text = oyAlphaPrint_( verbose );
-  if(text)
-  { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "Cache content: %s             ", text );
-  } else
-  { PRINT_SUB( oyTESTRESULT_FAIL,
-    "oyAlphaPrint_( ) failed                               " );
-  }
-
+  uint32_t icc_profile_flags =oyICCProfileSelectionFlagsFromOptions( OY_CMM_STD,
+                                       "//" OY_TYPE_STD "/icc_color", NULL, 0 );
+  oyProfile_s * p_in = oyProfile_FromStd( oyASSUMED_WEB, icc_profile_flags, testobj );
+  oyProfile_s * p_out = oyProfile_FromFile( "compatibleWithAdobeRGB1998.icc", icc_profile_flags, testobj );
+  /* 17 steps per channel meet most LUT cells away from the grid nodes */
+  const int steps = 17, count = steps*steps*steps;
+  uint8_t * buf_in = (uint8_t*) calloc( count * 4, 1 ),
+          * buf_ref = (uint8_t*) calloc( count * 4, 1 ),
+          * buf_lut = (uint8_t*) calloc( count * 4, 1 );
+  int i, j, max_diff = 0, alpha_kept = 1, cc_error = 0;
+  double clck;
+
+  for(i = 0; i < count; ++i)
+  {
+    buf_in[i*4+0] = (i / (steps*steps)) * 255 / (steps-1);
+    buf_in[i*4+1] = (i / steps % steps) * 255 / (steps-1);
+    buf_in[i*4+2] = (i % steps) * 255 / (steps-1);
+    buf_in[i*4+3] = 128;
+    buf_ref[i*4+3] = buf_lut[i*4+3] = 77;
+  }
+
+  oyOptions_s * options = NULL, * ref_options = NULL;
+  oyOptions_SetFromString( &options, "////context", "lcm2", OY_CREATE_NEW );
+  /* the nodes reference the options, so give each conversion its own */
+  oyOptions_CopyFrom( &ref_options, options, oyBOOLEAN_UNION, oyFILTER_REG_NONE, 0 );
+  oyOptions_SetFromString( &ref_options, "////precalculation", "0", OY_CREATE_NEW );
+  oyConversion_s * cc_ref = oyConversion_CreateBasicPixelsFromBuffers(
+                              p_in, buf_in, oyChannels_m(4) | oyDataType_m(oyUINT8),
+                              p_out, buf_ref, oyChannels_m(4) | oyDataType_m(oyUINT8),
+                                                    ref_options, count );
+  oyOptions_Release( &ref_options );
+  oyOptions_SetFromString( &options, "////precalculation", "4", OY_CREATE_NEW );
+  oyConversion_s * cc_lut = oyConversion_CreateBasicPixelsFromBuffers(
+                              p_in, buf_in, oyChannels_m(4) | oyDataType_m(oyUINT8),
+                              p_out, buf_lut, oyChannels_m(4) | oyDataType_m(oyUINT8),
+                                                    options, count );
+  oyOptions_Release( &options );
+
+  if(!cc_ref || !cc_lut)
+  { PRINT_SUB( oyTESTRESULT_XFAIL,
+    "no lcm2 conversion for 8-bit RGBA                " );
+  } else
+  {
+    cc_error = oyConversion_RunPixels( cc_ref, NULL );
+    clck = oyClock();
+    cc_error += oyConversion_RunPixels( cc_lut, NULL );
+    clck = oyClock() - clck;
+
+    const char * kernel = testIccNodeKernel_( cc_lut, "lut3d" );
+    if(!cc_error && kernel && !testIccNodeKernel_( cc_ref, "lut3d" ))
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "precalculation=4 native LUT selected, kernel: %s", kernel );
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "precalculation=4 native LUT selected, kernel: %s", oyNoEmptyString_m_(kernel) );
+    }
+
+    for(i = 0; i < count; ++i)
+    {
+      for(j = 0; j < 3; ++j)
+      {
+        int diff = abs( buf_ref[i*4+j] - buf_lut[i*4+j] );
+        if(diff > max_diff)
+          max_diff = diff;
+      }
+      if(buf_lut[i*4+3] != buf_ref[i*4+3])
+        alpha_kept = 0;
+    }
+
+    if(!cc_error && max_diff <= 2)
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "precalculation=4 vs. lcms max diff: %d %.03f", max_diff,
+                                       (double)clck/(double)CLOCKS_PER_SEC );
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "precalculation=4 vs. lcms max diff: %d error: %d", max_diff, cc_error );
+    }
+
+    if(alpha_kept)
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "precalculation=4 extra channel as lcms           " );
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "precalculation=4 extra channel as lcms           " );
+    }
+  }
+
+  oyConversion_Release( &cc_ref );
+  oyConversion_Release( &cc_lut );
+  oyProfile_Release( &p_in );
+  oyProfile_Release( &p_out );
+  free( buf_in );
+  free( buf_ref );
+  free( buf_lut );
+
+  return result;
+}
+
+/* half float bits; test values stay in the normal range */
+static uint16_t testFloatToHalf_( double v )
+{
+  uint16_t sign = v < 0.0 ? 0x8000 : 0;
+  double m;
+  int e;
+
+  if(v == 0.0)
+    return sign;
+  m = frexp( fabs( v ), &e );
+  /* the rounded mantissa may carry into the exponent */
+  return sign | (uint16_t)(((e - 1 + 15) << 10) +
+                           (int)floor( (m * 2.0 - 1.0) * 1024.0 + 0.5 ));
+}
+
+static double testHalfToFloat_( uint16_t h )
+{
+  int e = (h >> 10) & 0x1f, m = h & 0x3ff;
+  double v = e ? ldexp( 1.0 + m / 1024.0, e - 15 ) : ldexp( m / 1024.0, -14 );
+  return h & 0x8000 ? -v : v;
+}
+
+/* sample i of a buffer, integers scaled to 0..1 */
+static double testPixelGet_( oyDATATYPE_e type, void * buf, int i )
+{
+  switch(type)
+  {
+  case oyUINT16: return ((uint16_t*)buf)[i] / 65535.0;
+  case oyHALF:   return testHalfToFloat_( ((uint16_t*)buf)[i] );
+  case oyFLOAT:  return ((float*)buf)[i];
+  case oyDOUBLE: return ((double*)buf)[i];
+  default:       return 0.0;
+  }
+}
+
+static void testPixelSet_( oyDATATYPE_e type, void * buf, int i, double v )
+{
+  switch(type)
+  {
+  case oyUINT16: ((uint16_t*)buf)[i] = (uint16_t)OY_MAX( 0.0, OY_MIN( 65535.0, v * 65535.0 + 0.5 ) ); break;
+  case oyHALF:   ((uint16_t*)buf)[i] = testFloatToHalf_( v ); break;
+  case oyFLOAT:  ((float*)buf)[i] = (float) v; break;
+  case oyDOUBLE: ((double*)buf)[i] = v; break;
+  default: break;
+  }
+}
+
+oyTESTRESULT_e testCMMMatrixShaper( )
+{
+  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+
+  fprintf(stdout, "\n" );
+
+  uint32_t icc_profile_flags =oyICCProfileSelectionFlagsFromOptions( OY_CMM_STD,
+                                       "//" OY_TYPE_STD "/icc_color", NULL, 0 );
+  oyProfile_s * p_in = oyProfile_FromStd( oyASSUMED_WEB, icc_profile_flags, testobj );
+  oyProfile_s * p_out = oyProfile_FromFile( "compatibleWithAdobeRGB1998.icc", icc_profile_flags, testobj );
+  const int steps = 33, count = steps*steps*steps;
+  float * buf_in = (float*) calloc( count * 4, sizeof(float) ),
+        * buf_ref = (float*) calloc( count * 4, sizeof(float) ),
+        * buf_fast = (float*) calloc( count * 4, sizeof(float) );
+  int i, j, alpha_kept = 1, cc_error = 0;
+  double max_diff = 0.0, max_lin_diff = 0.0, clck;
+
+  for(i = 0; i < count; ++i)
+  {
+    buf_in[i*4+0] = (float)(i / (steps*steps)) / (steps-1);
+    buf_in[i*4+1] = (float)(i / steps % steps) / (steps-1);
+    buf_in[i*4+2] = (float)(i % steps) / (steps-1);
+    buf_in[i*4+3] = 0.5f;
+    buf_ref[i*4+3] = buf_fast[i*4+3] = 0.25f;
+  }
+
+  oyOptions_s * options = NULL;
+  oyOptions_SetFromString( &options, "////context", "lcm2", OY_CREATE_NEW );
+  oyOptions_SetFromString( &options, "////rendering_intent", "1", OY_CREATE_NEW );
+  oyOptions_SetFromString( &options, "////rendering_bpc", "0", OY_CREATE_NEW );
+  /* the fast path engages only without lcms' white fixup */
+  oyOptions_SetFromString( &options, "////no_white_on_white_fixup", "1", OY_CREATE_NEW );
+  /* cmsFLAGS_NOOPTIMIZE keeps the reference inside lcms */
+  oyOptions_s * ref_options = NULL;
+  /* the nodes reference the options, so give each conversion its own */
+  oyOptions_CopyFrom( &ref_options, options, oyBOOLEAN_UNION, oyFILTER_REG_NONE, 0 );
+  oyOptions_SetFromString( &ref_options, "////precalculation", "1", OY_CREATE_NEW );
+  oyConversion_s * cc_ref = oyConversion_CreateBasicPixelsFromBuffers(
+                              p_in, buf_in, oyChannels_m(4) | oyDataType_m(oyFLOAT),
+                              p_out, buf_ref, oyChannels_m(4) | oyDataType_m(oyFLOAT),
+                                                    ref_options, count );
+  oyOptions_Release( &ref_options );
+  oyOptions_SetFromString( &options, "////precalculation", "0", OY_CREATE_NEW );
+  oyConversion_s * cc_fast = oyConversion_CreateBasicPixelsFromBuffers(
+                              p_in, buf_in, oyChannels_m(4) | oyDataType_m(oyFLOAT),
+                              p_out, buf_fast, oyChannels_m(4) | oyDataType_m(oyFLOAT),
+                                                    options, count );
+  /* A2B/B2A CLUTs have to stay with lcms */
+  oyProfile_s * p_lut = oyProfile_FromFile( "sRGB_v4_ICC_preference.icc", icc_profile_flags, testobj );
+  oyConversion_s * cc_lut = NULL;
+  if(p_lut)
+    cc_lut = oyConversion_CreateBasicPixelsFromBuffers(
+                              p_in, buf_in, oyChannels_m(4) | oyDataType_m(oyFLOAT),
+                              p_lut, buf_ref, oyChannels_m(4) | oyDataType_m(oyFLOAT),
+                                                    options, count );
+  oyOptions_Release( &options );
+
+  if(!cc_ref || !cc_fast)
+  { PRINT_SUB( oyTESTRESULT_XFAIL,
+    "no lcm2 conversion for float RGBA                " );
+  } else
+  {
+    cc_error = oyConversion_RunPixels( cc_ref, NULL );
+    clck = oyClock();
+    cc_error += oyConversion_RunPixels( cc_fast, NULL );
+    clck = oyClock() - clck;
+
+    for(i = 0; i < count; ++i)
+    {
+      for(j = 0; j < 3; ++j)
+      {
+        double diff = fabs( buf_ref[i*4+j] - buf_fast[i*4+j] ),
+               /* AdobeRGB gamma; lcms' own inverse curve is coarse near black */
+               lin_diff = fabs( pow( fabs( buf_ref[i*4+j] ), 563.0/256.0 ) -
+                                pow( fabs( buf_fast[i*4+j] ), 563.0/256.0 ) );
+        if(lin_diff > max_lin_diff)
+          max_lin_diff = lin_diff;
+        if(diff > max_diff)
+          max_diff = diff;
+      }
+      if(buf_fast[i*4+3] != buf_ref[i*4+3])
+        alpha_kept = 0;
+    }
+
+    const char * kernel = testIccNodeKernel_( cc_fast, "matrix_shaper" );
+    if(kernel)
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "fast path selected, kernel: %s                  ", kernel );
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "fast path selected                               " );
+    }
+
+    if(!cc_error && max_lin_diff < 0.0002 && max_diff < 0.01)
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "float sRGB->AdobeRGB vs. lcms max diff: %g linear: %g %.03f", max_diff,
+                        max_lin_diff, (double)clck/(double)CLOCKS_PER_SEC );
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "float sRGB->AdobeRGB vs. lcms max diff: %g linear: %g error: %d",
+                                         max_diff, max_lin_diff, cc_error );
+    }
+
+    if(alpha_kept)
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "float extra channel as lcms                      " );
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "float extra channel as lcms                      " );
+    }
+  }
+
+  if(!cc_lut)
+  { PRINT_SUB( oyTESTRESULT_XFAIL,
+    "no sRGB_v4_ICC_preference.icc CLUT profile       " );
+  } else
+  {
+    cc_error = oyConversion_RunPixels( cc_lut, NULL );
+    if(!cc_error && !testIccNodeKernel_( cc_lut, "matrix_shaper" ))
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "CLUT profile stays with lcms                     " );
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "CLUT profile stays with lcms error: %d", cc_error );
+    }
+  }
+
+  /* every layout of the fast path; pixels beyond 0..1 are left to lcms */
+  {
+    struct { oyDATATYPE_e type; int channels; double lo, hi, tolerance; } cases[4] = {
+      { oyUINT16, 4, 0.0, 1.0, 0.0003 },
+      { oyHALF,   4, 0.0, 1.0, 0.002 },
+      { oyDOUBLE, 4, 0.0, 1.0, 0.0003 },
+      { oyFLOAT,  3, -0.1, 1.5, 0.0003 } };
+    const int n = 17, count_n = n*n*n;
+    int t, k;
+
+    for(t = 0; t < 4; ++t)
+    {
+      oyDATATYPE_e type = cases[t].type;
+      size_t size = oyDataTypeGetSize( type );
+      int ch = cases[t].channels;
+      oyPixel_t pixel_layout = oyChannels_m(ch) | oyDataType_m(type);
+      void * in = calloc( count_n * ch, size ),
+           * ref = calloc( count_n * ch, size ),
+           * fast = calloc( count_n * ch, size );
+      oyOptions_s * opts = NULL;
+      oyConversion_s * cc[2];
+      double lin_diff = 0.0;
+
+      for(i = 0; i < count_n; ++i)
+      {
+        int pos[3] = { i / (n*n), i / n % n, i % n };
+        for(j = 0; j < 3; ++j)
+          testPixelSet_( type, in, i*ch+j, cases[t].lo +
+                         (cases[t].hi - cases[t].lo) * pos[j] / (n-1) );
+        if(ch == 4)
+          testPixelSet_( type, in, i*4+3, 0.5 );
+      }
+
+      for(k = 0; k < 2; ++k)
+      {
+        oyOptions_SetFromString( &opts, "////context", "lcm2", OY_CREATE_NEW );
+        oyOptions_SetFromString( &opts, "////rendering_intent", "1", OY_CREATE_NEW );
+        oyOptions_SetFromString( &opts, "////rendering_bpc", "0", OY_CREATE_NEW );
+        oyOptions_SetFromString( &opts, "////no_white_on_white_fixup", "1", OY_CREATE_NEW );
+        oyOptions_SetFromString( &opts, "////precalculation", k ? "0" : "1", OY_CREATE_NEW );
+        cc[k] = oyConversion_CreateBasicPixelsFromBuffers(
+                              p_in, in, pixel_layout,
+                              p_out, k ? fast : ref, pixel_layout,
+                                                    opts, count_n );
+        oyOptions_Release( &opts );
+      }
+
+      cc_error = cc[0] && cc[1] ? oyConversion_RunPixels( cc[0], NULL ) +
+                                  oyConversion_RunPixels( cc[1], NULL ) : 1;
+      alpha_kept = 1;
+      for(i = 0; i < count_n; ++i)
+      {
+        for(j = 0; j < 3; ++j)
+        {
+          /* compare linear light, as in the float case above */
+          double r = testPixelGet_( type, ref, i*ch+j ),
+                 f = testPixelGet_( type, fast, i*ch+j ),
+                 d = fabs( (r < 0.0 ? -1 : 1) * pow( fabs( r ), 563.0/256.0 ) -
+                           (f < 0.0 ? -1 : 1) * pow( fabs( f ), 563.0/256.0 ) );
+          if(d > lin_diff)
+            lin_diff = d;
+        }
+        if(ch == 4 &&
+           testPixelGet_( type, fast, i*4+3 ) != testPixelGet_( type, ref, i*4+3 ))
+          alpha_kept = 0;
+      }
+
+      if(!cc_error && testIccNodeKernel_( cc[1], "matrix_shaper" ) &&
+         lin_diff < cases[t].tolerance && alpha_kept)
+      { PRINT_SUB( oyTESTRESULT_SUCCESS,
+        "%s[%d] %g..%g vs. lcms linear diff: %g", oyDataTypeToText(type),
+        ch, cases[t].lo, cases[t].hi, lin_diff );
+      } else
+      { PRINT_SUB( oyTESTRESULT_FAIL,
+        "%s[%d] %g..%g vs. lcms linear diff: %g kernel: %s alpha: %d error: %d",
+        oyDataTypeToText(type), ch, cases[t].lo, cases[t].hi, lin_diff,
+        oyNoEmptyString_m_( testIccNodeKernel_( cc[1], "matrix_shaper" ) ),
+        alpha_kept, cc_error );
+      }
+
+      oyConversion_Release( &cc[0] );
+      oyConversion_Release( &cc[1] );
+      free( in ); free( ref ); free( fast );
+    }
+  }
+
+  oyConversion_Release( &cc_ref );
+  oyConversion_Release( &cc_fast );
+  oyConversion_Release( &cc_lut );
+  oyProfile_Release( &p_in );
+  oyProfile_Release( &p_out );
+  oyProfile_Release( &p_lut );
+  free( buf_in );
+  free( buf_ref );
+  free( buf_fast );
+
+  return result;
+}
+
+/* in -> icc -> icc -> out with a float image between the ICC nodes */
+static oyConversion_s * testIccChainCreate_(
+                                       oyImage_s         * in,
+                                       oyImage_s         * mid,
+                                       oyImage_s         * out,
+                                       oyOptions_s       * options )
+{
+  oyConversion_s * cc = oyConversion_New( testobj );
+  oyFilterNode_s * root = oyFilterNode_NewWith( "//" OY_TYPE_STD "/root", NULL, testobj ),
+                 * icc1 = oyFilterNode_NewWith( "//" OY_TYPE_STD "/icc_color", options, testobj ),
+                 * icc2 = oyFilterNode_NewWith( "//" OY_TYPE_STD "/icc_color", options, testobj ),
+                 * output = oyFilterNode_NewWith( "//" OY_TYPE_STD "/output", NULL, testobj );
+  int error = !root || !icc1 || !icc2 || !output;
+
+  if(!error) error = oyConversion_Set( cc, root, 0 );
+  if(!error) error = oyFilterNode_SetData( root, (oyStruct_s*)in, 0, 0 );
+  if(!error) error = oyFilterNode_SetData( icc1, (oyStruct_s*)mid, 0, 0 );
+  if(!error) error = oyFilterNode_SetData( icc2, (oyStruct_s*)out, 0, 0 );
+  if(!error) error = oyFilterNode_Connect( root, "//" OY_TYPE_STD "/data",
+                                           icc1, "//" OY_TYPE_STD "/data", 0 );
+  if(!error) error = oyFilterNode_Connect( icc1, "//" OY_TYPE_STD "/data",
+                                           icc2, "//" OY_TYPE_STD "/data", 0 );
+  if(!error) error = oyFilterNode_Connect( icc2, "//" OY_TYPE_STD "/data",
+                                           output, "//" OY_TYPE_STD "/data", 0 );
+  if(!error) error = oyConversion_Set( cc, 0, output );
+
+  /* the conversion owns the connected nodes */
+  if(error)
+    oyConversion_Release( &cc );
+
+  return cc;
+}
+
+static int testIccChainCount_( oyConversion_s * cc )
+{
+  oyFilterNode_s * node = oyConversion_GetNode( cc, OY_INPUT );
+  oyFilterGraph_s * g = oyFilterGraph_FromNode( node, 0 );
+  int n = oyFilterGraph_CountNodes( g, "//" OY_TYPE_STD "/icc_color", NULL );
+
+  oyFilterGraph_Release( &g );
+  oyFilterNode_Release( &node );
+
+  return n;
+}
+
+#include "oyFilterNode_s_.h"
+/* references to node beside its own sockets, plugs and observations, which
+ * point back to the node as accounted for in oyFilterNode_Release_() */
+static int testNodeForeignRefs_( oyFilterNode_s * node )
+{
+  oyFilterNode_s_ * s = (oyFilterNode_s_*) node;
+  int refs = oyObject_GetRefCount( s->oy_ ) -
+             2 * oyStruct_ObservationCount( (oyStruct_s*)s, 0 ), i;
+
+  for(i = 0; i < oyFilterNode_EdgeCount( node, 0, 0 ); ++i)
+    if(s->sockets && s->sockets[i] && s->sockets[i]->node)
+      --refs;
+  for(i = 0; i < oyFilterNode_EdgeCount( node, 1, 0 ); ++i)
+    if(s->plugs && s->plugs[i] && s->plugs[i]->node)
+      --refs;
+
+  return refs;
+}
+
+oyTESTRESULT_e testCMMIccMerge( )
+{
+  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+
+  fprintf(stdout, "\n" );
+
+  uint32_t icc_profile_flags =oyICCProfileSelectionFlagsFromOptions( OY_CMM_STD,
+                                       "//" OY_TYPE_STD "/icc_color", NULL, 0 );
+  oyProfile_s * p_in = oyProfile_FromStd( oyASSUMED_WEB, icc_profile_flags, testobj ),
+              * p_mid = oyProfile_FromFile( "compatibleWithAdobeRGB1998.icc", icc_profile_flags, testobj ),
+              * p_out = oyProfile_FromStd( oyEDITING_XYZ, icc_profile_flags, testobj );
+  const int steps = 17, count = steps*steps*steps;
+  float * buf_in = (float*) calloc( count * 3, sizeof(float) ),
+        * buf_mid = (float*) calloc( count * 3, sizeof(float) ),
+        * buf_ref = (float*) calloc( count * 3, sizeof(float) ),
+        * buf_merged = (float*) calloc( count * 3, sizeof(float) );
+  int i, nodes_ref = 0, nodes_merged = 0, cc_error = 0;
+  double max_diff = 0.0, clck_ref = 0, clck_merged = 0;
+
+  for(i = 0; i < count; ++i)
+  {
+    buf_in[i*3+0] = (float)(i / (steps*steps)) / (steps-1);
+    buf_in[i*3+1] = (float)(i / steps % steps) / (steps-1);
+    buf_in[i*3+2] = (float)(i % steps) / (steps-1);
+  }
+
+  oyImage_s * in = oyImage_Create( count, 1, buf_in, OY_TYPE_123_FLOAT, p_in, testobj ),
+            * mid = oyImage_Create( count, 1, buf_mid, OY_TYPE_123_FLOAT, p_mid, testobj ),
+            * out_ref = oyImage_Create( count, 1, buf_ref, OY_TYPE_123_FLOAT, p_out, testobj ),
+            * out_merged = oyImage_Create( count, 1, buf_merged, OY_TYPE_123_FLOAT, p_out, testobj );
+
+  oyOptions_s * options = NULL;
+  oyOptions_SetFromString( &options, "////context", "lcm2", OY_CREATE_NEW );
+  oyOptions_SetFromString( &options, "////rendering_intent", "1", OY_CREATE_NEW );
+  oyOptions_SetFromString( &options, "////rendering_bpc", "0", OY_CREATE_NEW );
+  oyConversion_s * cc_ref = testIccChainCreate_( in, mid, out_ref, options ),
+                 * cc_merged = testIccChainCreate_( in, mid, out_merged, options );
+  oyOptions_Release( &options );
+
+  /* the first ICC node gets merged away and shall not leak */
+  oyFilterNode_s * root = oyConversion_GetNode( cc_merged, OY_INPUT ),
+                 * merged_away = oyFilterNode_GetSocketNode( root, 0, 0 );
+  oyFilterNode_Release( &root );
+
+  if(cc_merged)
+    oyConversion_Correct( cc_merged, "//" OY_TYPE_STD "/icc_color", 0, NULL );
+  nodes_ref = testIccChainCount_( cc_ref );
+  nodes_merged = testIccChainCount_( cc_merged );
+
+  if(!in || !mid || !out_ref || !cc_ref || !cc_merged || nodes_ref != 2)
+  { PRINT_SUB( oyTESTRESULT_XFAIL,
+    "no ICC node chain                                " );
+  } else
+  {
+    clck_ref = oyClock();
+    cc_error = oyConversion_RunPixels( cc_ref, NULL );
+    clck_ref = oyClock() - clck_ref;
+    clck_merged = oyClock();
+    cc_error += oyConversion_RunPixels( cc_merged, NULL );
+    clck_merged = oyClock() - clck_merged;
+
+    for(i = 0; i < count*3; ++i)
+    {
+      double diff = fabs( buf_ref[i] - buf_merged[i] );
+      if(diff > max_diff)
+        max_diff = diff;
+    }
+
+    if(nodes_merged == 1)
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "oyConversion_Correct() merged ICC nodes %d -> %d   ", nodes_ref, nodes_merged );
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "oyConversion_Correct() merged ICC nodes %d -> %d   ", nodes_ref, nodes_merged );
+    }
+
+    if(!cc_error && max_diff < 0.001)
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "merged vs. chained max diff: %g %.03f/%.03f", max_diff,
+                                   clck_merged/(double)CLOCKS_PER_SEC,
+                                   clck_ref/(double)CLOCKS_PER_SEC );
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "merged vs. chained max diff: %g error: %d", max_diff, cc_error );
+    }
+  }
+
+  oyConversion_Release( &cc_ref );
+  oyConversion_Release( &cc_merged );
+
+  if(merged_away)
+  {
+    int refs = testNodeForeignRefs_( merged_away );
+    if(refs == 1)
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "merged away node released with the conversion    " );
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "merged away node released with the conversion refs: %d", refs );
+    }
+  }
+  oyFilterNode_Release( &merged_away );
+
+  oyImage_Release( &in );
+  oyImage_Release( &mid );
+  oyImage_Release( &out_ref );
+  oyImage_Release( &out_merged );
+  oyProfile_Release( &p_in );
+  oyProfile_Release( &p_mid );
+  oyProfile_Release( &p_out );
+  free( buf_in );
+  free( buf_mid );
+  free( buf_ref );
+  free( buf_merged );
+
+  return result;
+}
+
+/* convert count pixels through lcm2 */
+static int testLcm2Convert_( oyProfile_s * p_in, void * buf_in, oyPixel_t pixel_in,
+                             oyProfile_s * p_out, void * buf_out, oyPixel_t pixel_out,
+                             int count )
+{
+  oyOptions_s * opts = NULL;
+  oyConversion_s * cc;
+  int error;
+
+  oyOptions_SetFromString( &opts, "////context", "lcm2", OY_CREATE_NEW );
+  cc = oyConversion_CreateBasicPixelsFromBuffers( p_in, buf_in, pixel_in,
+                                                  p_out, buf_out, pixel_out,
+                                                  opts, count );
+  oyOptions_Release( &opts );
+  error = cc ? oyConversion_RunPixels( cc, NULL ) : 1;
+  oyConversion_Release( &cc );
+
+  return error;
+}
+
+oyTESTRESULT_e testCMMXYZExtra( )
+{
+  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+
+  fprintf(stdout, "\n" );
+
+  uint32_t icc_profile_flags =oyICCProfileSelectionFlagsFromOptions( OY_CMM_STD,
+                                       "//" OY_TYPE_STD "/icc_color", NULL, 0 );
+  oyProfile_s * p_rgb = oyProfile_FromStd( oyASSUMED_WEB, icc_profile_flags, testobj ),
+              * p_xyz = oyProfile_FromStd( oyEDITING_XYZ, icc_profile_flags, testobj );
+  /* more than one l2cmsTransformLine_() chunk */
+  const int steps = 9, count = steps*steps*steps;
+  oyDATATYPE_e types[2] = { oyFLOAT, oyDOUBLE };
+  int t;
+
+  for(t = 0; t < 2; ++t)
+  {
+    oyDATATYPE_e type = types[t];
+    size_t size = oyDataTypeGetSize( type );
+    void * rgba = calloc( count * 4, size ),
+         * rgb = calloc( count * 3, size ),
+         * xyza = calloc( count * 4, size ),
+         * xyz = calloc( count * 3, size ),
+         * rgba2 = calloc( count * 4, size );
+    double xyz_diff = 0.0, rgb_diff = 0.0, alpha_diff = 0.0, d;
+    int i, c, error = 0;
+
+    for(i = 0; i < count; ++i)
+    {
+      double v[3] = { (double)(i / (steps*steps)) / (steps-1),
+                      (double)(i / steps % steps) / (steps-1),
+                      (double)(i % steps) / (steps-1) };
+      for(c = 0; c < 3; ++c)
+      {
+        testPixelSet_( type, rgba, i*4+c, v[c] );
+        testPixelSet_( type, rgb, i*3+c, v[c] );
+      }
+      testPixelSet_( type, rgba, i*4+3, (double)i / count );
+    }
+
+    error = testLcm2Convert_( p_rgb, rgb, oyChannels_m(3) | oyDataType_m(type),
+                              p_xyz, xyz, oyChannels_m(3) | oyDataType_m(type),
+                              count );
+    if(!error)
+    error = testLcm2Convert_( p_rgb, rgba, oyChannels_m(4) | oyDataType_m(type),
+                              p_xyz, xyza, oyChannels_m(4) | oyDataType_m(type),
+                              count );
+    if(!error)
+    error = testLcm2Convert_( p_xyz, xyza, oyChannels_m(4) | oyDataType_m(type),
+                              p_rgb, rgba2, oyChannels_m(4) | oyDataType_m(type),
+                              count );
+
+    for(i = 0; i < count; ++i)
+    {
+      for(c = 0; c < 3; ++c)
+      {
+        d = fabs( testPixelGet_( type, xyza, i*4+c ) - testPixelGet_( type, xyz, i*3+c ) );
+        if(d > xyz_diff) xyz_diff = d;
+        d = fabs( testPixelGet_( type, rgba2, i*4+c ) - testPixelGet_( type, rgba, i*4+c ) );
+        if(d > rgb_diff) rgb_diff = d;
+      }
+      /* the extra channel passes unscaled through both conversions */
+      d = fabs( testPixelGet_( type, xyza, i*4+3 ) - testPixelGet_( type, rgba, i*4+3 ) );
+      if(d > alpha_diff) alpha_diff = d;
+      d = fabs( testPixelGet_( type, rgba2, i*4+3 ) - testPixelGet_( type, rgba, i*4+3 ) );
+      if(d > alpha_diff) alpha_diff = d;
+    }
+
+    if(!error && xyz_diff < 0.0001 && rgb_diff < 0.001 && alpha_diff == 0.0)
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "%s XYZA round trip diff: %g %g alpha: %g",
+      oyDataTypeToText(type), xyz_diff, rgb_diff, alpha_diff );
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "%s XYZA round trip diff: %g %g alpha: %g error: %d",
+      oyDataTypeToText(type), xyz_diff, rgb_diff, alpha_diff, error );
+    }
+
+    free( rgba ); free( rgb ); free( xyza ); free( xyz ); free( rgba2 );
+  }
+
+  oyProfile_Release( &p_rgb );
+  oyProfile_Release( &p_xyz );
+
+  return result;
+}
+
+/* in -> expose -> channel -> out */
+static oyConversion_s * testBakeChainCreate_(
+                                       oyImage_s         * in,
+                                       oyImage_s         * mid,
+                                       oyImage_s         * out )
+{
+  oyConversion_s * cc = oyConversion_New( testobj );
+  oyOptions_s * opts = NULL;
+  oyFilterNode_s * root = oyFilterNode_NewWith( "//" OY_TYPE_STD "/root", NULL, testobj ),
+                 * expose, * channel,
+                 * output = oyFilterNode_NewWith( "//" OY_TYPE_STD "/output", NULL, testobj );
+  int error;
+
+  oyOptions_SetFromDouble( &opts, "//" OY_TYPE_STD "/expose/expose", 0.8, 0, OY_CREATE_NEW );
+  expose = oyFilterNode_NewWith( "//" OY_TYPE_STD "/expose", opts, testobj );
+  oyOptions_Release( &opts );
+  oyOptions_SetFromString( &opts, "//" OY_TYPE_STD "/channel/channel", "[\"c\", \"b\", \"a\"]", OY_CREATE_NEW );
+  channel = oyFilterNode_NewWith( "//" OY_TYPE_STD "/channel", opts, testobj );
+  oyOptions_Release( &opts );
+
+  error = !root || !expose || !channel || !output;
+  if(!error) error = oyConversion_Set( cc, root, 0 );
+  if(!error) error = oyFilterNode_SetData( root, (oyStruct_s*)in, 0, 0 );
+  if(!error) error = oyFilterNode_SetData( expose, (oyStruct_s*)mid, 0, 0 );
+  if(!error) error = oyFilterNode_SetData( channel, (oyStruct_s*)out, 0, 0 );
+  if(!error) error = oyFilterNode_Connect( root, "//" OY_TYPE_STD "/data",
+                                           expose, "//" OY_TYPE_STD "/data", 0 );
+  if(!error) error = oyFilterNode_Connect( expose, "//" OY_TYPE_STD "/data",
+                                           channel, "//" OY_TYPE_STD "/data", 0 );
+  if(!error) error = oyFilterNode_Connect( channel, "//" OY_TYPE_STD "/data",
+                                           output, "//" OY_TYPE_STD "/data", 0 );
+  if(!error) error = oyConversion_Set( cc, 0, output );
+
+  /* the conversion owns the connected nodes */
+  if(error)
+    oyConversion_Release( &cc );
+
+  return cc;
+}
+
+static int testBakeCount_( oyConversion_s * cc, const char * pattern )
+{
+  oyFilterNode_s * node = oyConversion_GetNode( cc, OY_INPUT );
+  oyFilterGraph_s * g = oyFilterGraph_FromNode( node, 0 );
+  int n = oyFilterGraph_CountNodes( g, pattern, NULL );
+
+  oyFilterGraph_Release( &g );
+  oyFilterNode_Release( &node );
+
+  return n;
+}
+
+oyTESTRESULT_e testCMMBake( )
+{
+  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+
+  fprintf(stdout, "\n" );
+
+  oyProfile_s * p = oyProfile_FromStd( oyASSUMED_WEB, 0, testobj );
+  const int count = 10000;
+  float * buf_in = (float*) calloc( count * 3, sizeof(float) ),
+        * buf_mid = (float*) calloc( count * 3, sizeof(float) ),
+        * buf_ref = (float*) calloc( count * 3, sizeof(float) ),
+        * buf_baked = (float*) calloc( count * 3, sizeof(float) );
+  int i, cc_error = 0, error;
+  double max_diff = 0.0;
+
+  for(i = 0; i < count * 3; ++i)
+    buf_in[i] = (float)((i * 37) % 1001) / 1000.0f;
+
+  oyImage_s * in = oyImage_Create( count, 1, buf_in, OY_TYPE_123_FLOAT, p, testobj ),
+            * mid = oyImage_Create( count, 1, buf_mid, OY_TYPE_123_FLOAT, p, testobj ),
+            * out_ref = oyImage_Create( count, 1, buf_ref, OY_TYPE_123_FLOAT, p, testobj ),
+            * out_baked = oyImage_Create( count, 1, buf_baked, OY_TYPE_123_FLOAT, p, testobj );
+  oyConversion_s * cc_ref = testBakeChainCreate_( in, mid, out_ref ),
+                 * cc_baked = testBakeChainCreate_( in, mid, out_baked );
+  oyOptions_s * opts = NULL;
+
+  /* the last chain node gets baked away and shall not leak */
+  oyFilterNode_s * out = oyConversion_GetNode( cc_baked, OY_OUTPUT ),
+                 * baked_away = oyFilterNode_GetPlugNode( out, 0 );
+  oyFilterNode_Release( &out );
+
+  oyOptions_SetFromInt( &opts, "////grid_points", 9, 0, OY_CREATE_NEW );
+  error = oyConversion_Correct( cc_baked, "//" OY_TYPE_STD "/bake", 0, opts );
+  oyOptions_Release( &opts );
+
+  if(!in || !mid || !out_ref || !out_baked || !cc_ref || !cc_baked || error)
+  { PRINT_SUB( oyTESTRESULT_XFAIL,
+    "no point wise chain                              " );
+  } else
+  {
+    int clut_n = testBakeCount_( cc_baked, "//" OY_TYPE_STD "/clut" ),
+        expose_n = testBakeCount_( cc_baked, "//" OY_TYPE_STD "/expose" );
+
+    if(clut_n == 1 && expose_n == 0)
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "oyConversion_Correct(bake) clut: %d expose: %d    ", clut_n, expose_n );
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "oyConversion_Correct(bake) clut: %d expose: %d    ", clut_n, expose_n );
+    }
+
+    cc_error = oyConversion_RunPixels( cc_ref, NULL );
+    cc_error += oyConversion_RunPixels( cc_baked, NULL );
+
+    for(i = 0; i < count*3; ++i)
+    {
+      double diff = fabs( buf_ref[i] - buf_baked[i] );
+      if(diff > max_diff)
+        max_diff = diff;
+    }
+
+    /* expose 0.8 and a channel swap are linear and need no dense grid */
+    if(!cc_error && max_diff < 0.0001 && buf_baked[0] != 0.0f)
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "baked vs. chained max diff: %g                ", max_diff );
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "baked vs. chained max diff: %g error: %d", max_diff, cc_error );
+    }
+  }
+
+  oyConversion_Release( &cc_ref );
+  oyConversion_Release( &cc_baked );
+
+  if(baked_away && !error)
+  {
+    int refs = testNodeForeignRefs_( baked_away );
+    if(refs == 1)
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "baked away node released with the conversion    " );
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "baked away node released with the conversion refs: %d", refs );
+    }
+  }
+  oyFilterNode_Release( &baked_away );
+
+  oyImage_Release( &in );
+  oyImage_Release( &mid );
+  oyImage_Release( &out_ref );
+  oyImage_Release( &out_baked );
+  oyProfile_Release( &p );
+  free( buf_in );
+  free( buf_mid );
+  free( buf_ref );
+  free( buf_baked );
+
+  return result;
+}
+
+/* root -> icc[0] -> ... -> icc[n-1] -> output; images[i+1] feeds icc[i] */
+static oyConversion_s * testIccChainNCreate_(
+                                       oyImage_s        ** images,
+                                       oyOptions_s      ** options,
+                                       int                 n )
+{
+  oyConversion_s * cc = oyConversion_New( testobj );
+  oyFilterNode_s * root = oyFilterNode_NewWith( "//" OY_TYPE_STD "/root", NULL, testobj ),
+                 * output = oyFilterNode_NewWith( "//" OY_TYPE_STD "/output", NULL, testobj ),
+                 * prev = root;
+  int error = !root || !output, i;
+
+  if(!error) error = oyConversion_Set( cc, root, 0 );
+  if(!error) error = oyFilterNode_SetData( root, (oyStruct_s*)images[0], 0, 0 );
+  for(i = 0; i < n && !error; ++i)
+  {
+    oyFilterNode_s * icc = oyFilterNode_NewWith( "//" OY_TYPE_STD "/icc_color",
+                                                 options[i], testobj );
+    error = !icc;
+    if(!error) error = oyFilterNode_SetData( icc, (oyStruct_s*)images[i+1], 0, 0 );
+    if(!error) error = oyFilterNode_Connect( prev, "//" OY_TYPE_STD "/data",
+                                             icc, "//" OY_TYPE_STD "/data", 0 );
+    prev = icc;
+  }
+  if(!error) error = oyFilterNode_Connect( prev, "//" OY_TYPE_STD "/data",
+                                           output, "//" OY_TYPE_STD "/data", 0 );
+  if(!error) error = oyConversion_Set( cc, 0, output );
+
+  /* the conversion owns the connected nodes */
+  if(error)
+    oyConversion_Release( &cc );
+
+  return cc;
+}
+
+oyTESTRESULT_e testCMMPrepareThreads( )
+{
+  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+
+  fprintf(stdout, "\n" );
+
+  uint32_t icc_profile_flags =oyICCProfileSelectionFlagsFromOptions( OY_CMM_STD,
+                                       "//" OY_TYPE_STD "/icc_color", NULL, 0 );
+  oyProfile_s * p_web = oyProfile_FromStd( oyASSUMED_WEB, icc_profile_flags, testobj ),
+              * p_lab = oyProfile_FromStd( oyEDITING_LAB, icc_profile_flags, testobj ),
+              * p_cmyk = oyProfile_FromStd( oyEDITING_CMYK, icc_profile_flags, testobj ),
+              * p_display = oyProfile_FromFile( "compatibleWithAdobeRGB1998.icc", icc_profile_flags, testobj ),
+              * abstract = NULL;
+  oyOptions_s * opts = NULL, * result_opts = NULL;
+  const int w = 64, h = 32;
+  uint16_t * buf_in = (uint16_t*) calloc( sizeof(uint16_t), w*h*3 ),
+           * buf_out[2] = { (uint16_t*) calloc( sizeof(uint16_t), w*h*3 ),
+                            (uint16_t*) calloc( sizeof(uint16_t), w*h*3 ) };
+  float * buf_mid = (float*) calloc( sizeof(float), w*h*3*2 );
+  int i, pass, diff = 0, filled = 0, error = 0, threads = 1;
+  double clck[2] = {0,0};
+
+  oyOptions_SetFromDouble( &opts, "//" OY_TYPE_STD "/cie_a", 0.02, 0, OY_CREATE_NEW );
+  oyOptions_SetFromDouble( &opts, "//" OY_TYPE_STD "/cie_b", -0.05, 0, OY_CREATE_NEW );
+  oyOptions_Handle( "//" OY_TYPE_STD "/create_profile.white_point_adjust.lab",
+                    opts,"create_profile.white_point_adjust.lab",
+                    &result_opts );
+  abstract = (oyProfile_s*)oyOptions_GetType( result_opts, -1, "icc_profile",
+                                              oyOBJECT_PROFILE_S );
+  oyOptions_Release( &result_opts );
+  oyOptions_Release( &opts );
+
+  for(i = 0; i < w*h*3; ++i)
+    buf_in[i] = (i * 997) % 65536;
+
+  if(!p_cmyk || !p_display || !abstract)
+  { PRINT_SUB( oyTESTRESULT_XFAIL,
+    "no CMYK, display or effect profile               " );
+  } else
+  {
+    /* thread locking comes with the job system, see oyThreadLockingSet() */
+    if(!oyThreadLockingReady())
+    {
+      uint16_t px_in[3] = {0,0,0}, px_out[3];
+      oyConversion_s * cc = oyConversion_CreateBasicPixelsFromBuffers(
+                              p_web, px_in, OY_TYPE_123_16,
+                              p_lab, px_out, OY_TYPE_123_16, NULL, 1 );
+      oyJob_s * job = oyJob_New( testobj );
+      job->finish = testAsyncFinish;
+      test_async_status = 0;
+      testAsyncWait( oyConversion_RunPixelsAsync( cc, NULL, 1, 1, &job ) );
+      oyConversion_Release( &cc );
+    }
+#if defined(USE_OPENMP)
+    threads = omp_get_max_threads();
+#endif
+
+    /* pass 0 prepares the contexts serially, pass 1 on several threads */
+    for(pass = 0; pass < 2 && !error; ++pass)
+    {
+      oyOptions_s * node_opts[3] = {NULL,NULL,NULL};
+      oyProfiles_s * proofs = oyProfiles_New( testobj ),
+                   * effects = oyProfiles_New( testobj );
+      oyProfile_s * p;
+      oyImage_s * images[4] = {
+        oyImage_Create( w,h, buf_in, OY_TYPE_123_16, p_web, testobj ),
+        oyImage_Create( w,h, buf_mid, OY_TYPE_123_FLOAT, p_lab, testobj ),
+        oyImage_Create( w,h, &buf_mid[w*h*3], OY_TYPE_123_FLOAT, p_lab, testobj ),
+        oyImage_Create( w,h, buf_out[pass], OY_TYPE_123_16, p_display, testobj ) };
+      oyConversion_s * cc;
+
+      for(i = 0; i < 3; ++i)
+        oyOptions_SetFromString( &node_opts[i], "////context", "lcm2", OY_CREATE_NEW );
+      /* proof */
+      p = oyProfile_Copy( p_cmyk, NULL );
+      oyProfiles_MoveIn( proofs, &p, -1 );
+      oyOptions_MoveInStruct( &node_opts[0], OY_PROFILES_SIMULATION,
+                              (oyStruct_s**)&proofs, OY_CREATE_NEW );
+      oyOptions_SetFromString( &node_opts[0], "////proof_soft", "1", OY_CREATE_NEW );
+      /* effect */
+      p = oyProfile_Copy( abstract, NULL );
+      oyProfiles_MoveIn( effects, &p, -1 );
+      oyOptions_MoveInStruct( &node_opts[1], OY_PROFILES_EFFECT,
+                              (oyStruct_s**)&effects, OY_CREATE_NEW );
+      oyOptions_SetFromString( &node_opts[1], "////effect_switch", "1", OY_CREATE_NEW );
+      /* display: Lab -> monitor */
+
+      cc = testIccChainNCreate_( images, node_opts, 3 );
+
+      /* build every context again */
+      oyStructList_Clear( *oyCMMCacheList_() );
+#if defined(USE_OPENMP)
+      omp_set_num_threads( pass ? 4 : 1 );
+#endif
+      error = !cc;
+      if(!error)
+      {
+        oyFilterGraph_s * graph = oyConversion_GetGraph( cc );
+        clck[pass] = oyClock();
+        error = oyFilterGraph_PrepareContexts( graph, 0 );
+        clck[pass] = oyClock() - clck[pass];
+        oyFilterGraph_Release( &graph );
+      }
+      if(!error)
+        error = oyConversion_RunPixels( cc, NULL );
+
+      oyConversion_Release( &cc );
+      for(i = 0; i < 4; ++i)
+        oyImage_Release( &images[i] );
+      for(i = 0; i < 3; ++i)
+        oyOptions_Release( &node_opts[i] );
+    }
+#if defined(USE_OPENMP)
+    omp_set_num_threads( threads );
+#endif
+
+    for(i = 0; i < w*h*3; ++i)
+    {
+      if(buf_out[0][i] != buf_out[1][i])
+        ++diff;
+      if(buf_out[1][i])
+        ++filled;
+    }
+
+    if(!error && !diff && filled && oyThreadLockingReady())
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "proof+effect+display parallel as serial %s",
+                   oyProfilingToString(1,clck[1]/(double)CLOCKS_PER_SEC,"Graph"));
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "proof+effect+display parallel as serial error: %d diff: %d filled: %d",
+                                                       error, diff, filled );
+    }
+    fprintf( zout, "serial preparation: %s\n",
+                   oyProfilingToString(1,clck[0]/(double)CLOCKS_PER_SEC,"Graph"));
+
+    /* each job needs its own lcm2 transform, as the pixel layouts differ;
+     * more jobs than lcms contexts in the module pool */
+    {
+      const int jobs = 32, count = 256;
+      double * rgb = (double*) calloc( sizeof(double), count*6 ),
+             * rgb_out = (double*) calloc( sizeof(double), jobs*count*6 );
+      int j, jerrors = 0;
+      double max_diff = 0.0;
+
+      for(i = 0; i < count*6; ++i)
+        rgb[i] = (double)((i * 997) % 256) / 255.0;
+
+#if defined(USE_OPENMP)
+#pragma omp parallel for num_threads(8) reduction(+:jerrors)
+#endif
+      for(j = 0; j < jobs; ++j)
+      {
+        oyDATATYPE_e type = j < jobs/2 ? oyFLOAT : oyDOUBLE;
+        int cin = 3 + j % 4, cout = 3 + j / 4 % 4, k;
+        size_t size = oyDataTypeGetSize( type );
+        void * in = calloc( size, count*cin ),
+             * out = calloc( size, count*cout );
+
+        for(k = 0; k < count*3; ++k)
+          testPixelSet_( type, in, k/3*cin + k%3, rgb[k] );
+        jerrors += testLcm2Convert_( p_web, in, oyChannels_m(cin) | oyDataType_m(type),
+                                     p_display, out, oyChannels_m(cout) | oyDataType_m(type),
+                                     count );
+        for(k = 0; k < count*3; ++k)
+          rgb_out[j*count*3 + k] = testPixelGet_( type, out, k/3*cout + k%3 );
+        free( in );
+        free( out );
+      }
+
+      for(j = 1; j < jobs; ++j)
+        for(i = 0; i < count*3; ++i)
+        {
+          double d = fabs( rgb_out[j*count*3 + i] - rgb_out[i] );
+          if(d > max_diff) max_diff = d;
+        }
+
+      if(!jerrors && max_diff < 0.001)
+      { PRINT_SUB( oyTESTRESULT_SUCCESS,
+        "%d transforms created on 8 threads max diff: %g", jobs, max_diff );
+      } else
+      { PRINT_SUB( oyTESTRESULT_FAIL,
+        "%d transforms created on 8 threads max diff: %g error: %d", jobs, max_diff, jerrors );
+      }
+      free( rgb );
+      free( rgb_out );
+    }
+  }
+
+  oyProfile_Release( &p_web );
+  oyProfile_Release( &p_lab );
+  oyProfile_Release( &p_cmyk );
+  oyProfile_Release( &p_display );
+  oyProfile_Release( &abstract );
+  free( buf_in );
+  free( buf_mid );
+  free( buf_out[0] );
+  free( buf_out[1] );
+
+  return result;
+}
+
+#include "oyranos_generic_internal.h"
+#include "oyranos_io.h"             /* OS_DL_CACHE_USER_DIR */
+oyHash_s *   oyTestCacheListGetEntry_ ( const char        * hash_text)
+{
+  if(!oy_test_cache_)
+    oy_test_cache_ = oyStructList_Create( oyOBJECT_NONE, "oy_test_cache_", testobj );
+
+  return oyCacheListGetEntry_(oy_test_cache_, 0, hash_text);
+}
+
+oyTESTRESULT_e testCache()
+{
+  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+
+  fprintf(stdout, "\n" );
+
+  int verbose = 0;
+  char * text = oyAlphaPrint_( verbose );
+  if(text)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "Cache content: %s             ", text );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyAlphaPrint_( ) failed                               " );
+  }
+
   const char * hash_texts[] = {
     "A", "B", "AB", "ABC", "abc", "ABCDEF",
     "org/freedesktop/openicc/foo/bar/long/item",
@@ -7957,6 +9779,69 @@ oyTESTRESULT_e testCache()
 
   oyTestCacheListClear_();
 
+  /* device link disk cache round trip */
+  oyFilterNode_s_ * node = (oyFilterNode_s_*) oyFilterNode_NewWith( "//" OY_TYPE_STD "/root", NULL, testobj );
+  char context_type[8] = {0};
+  char blob[256];
+  size_t size = 0;
+  for(i = 0; i < 256; ++i) blob[i] = i;
+  char * key = NULL;
+  oyStringAddPrintf_( &key, 0,0, "test2 disk cache %g", oySeconds() );
+  int error = !node;
+  char * ptr = NULL;
+  if(!error)
+  {
+    memcpy( context_type, node->core->api4_->context_type, 8 );
+    strcpy( node->core->api4_->context_type, "oyTS" );
+    error = oyFilterNode_ContextToDisk_( node, key, blob, 256 );
+    ptr = (char*) oyFilterNode_ContextFromDisk_( node, key, &size );
+    memcpy( node->core->api4_->context_type, context_type, 8 );
+  }
+  if( !error && ptr && size == 256 && memcmp( ptr, blob, 256 ) == 0 )
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyFilterNode_ContextFromDisk_()                  " );
+  } else
+  { PRINT_SUB( oyTESTRESULT_XFAIL,
+    "oyFilterNode_ContextFromDisk_() error: %d size: %d", error, (int)size );
+  }
+  if(ptr) oyFree_m_( ptr );
+
+  /* a other module version must not read the file; a full cache must
+   * not remove foreign files of the directory */
+  char * dir = oyResolveDirFileName_( OS_DL_CACHE_USER_DIR ),
+       * foreign = NULL;
+  int foreign_kept = 0;
+  ptr = NULL;
+  if(!error && dir)
+  {
+    oyStringAddPrintf_( &foreign, 0,0, "%s" OY_SLASH "test2-foreign.txt", dir );
+    oyWriteMemToFile_( foreign, blob, 256 );
+    memcpy( context_type, node->core->api4_->context_type, 8 );
+    strcpy( node->core->api4_->context_type, "oyTS" );
+    setenv( "OY_DL_CACHE_SIZE", "200", 1 );
+    ++node->core->api4_->version[2];
+    ptr = (char*) oyFilterNode_ContextFromDisk_( node, key, &size );
+    --node->core->api4_->version[2];
+    oyFilterNode_ContextToDisk_( node, key, blob, 128 );
+    unsetenv( "OY_DL_CACHE_SIZE" );
+    memcpy( node->core->api4_->context_type, context_type, 8 );
+    foreign_kept = oyIsFile_( foreign );
+    oyRemoveFile_( foreign );
+    oyFree_m_( foreign );
+  }
+  if( !error && dir && !ptr && foreign_kept )
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "disk cache module version and own files          " );
+  } else
+  { PRINT_SUB( oyTESTRESULT_XFAIL,
+    "disk cache module version: %s foreign file: %d", ptr ? "read" : "ignored",
+    foreign_kept );
+  }
+  if(ptr) oyFree_m_( ptr );
+  if(dir) oyFree_m_( dir );
+  oyFree_m_( key );
+  oyFilterNode_Release( (oyFilterNode_s**)&node );
+
   return result;
 }
 